@@ -1,12 +1,37 @@
 #include "BattleManager.h"
+#include <algorithm>
 #include <iostream>
-#include <random>
 #include <thread>
 
+/**
+ * @brief Turn start system: every living combatant regenerates mana when a new round begins.
+ * @param world The battle's world; the round is read from its TurnCounter resource.
+ * @details Each combatant acts once per round, so this matches regenerating the actor's mana every turn,
+ *          while touching every entity in one parallel pass instead of one lookup per turn.
+ */
+static void regenerateMana(World& world) {
+    const TurnCounter* turns = world.getResource<TurnCounter>();
+    if (!turns || turns->turn != turns->roundStart) return;
+
+    world.view<CombatState, const CombatBaseStats>().with<Alive>().parEach(
+        [](EntityId, CombatState& state, const CombatBaseStats& base) {
+            state.mana = std::min(base.maxMana, state.mana + 5);
+        });
+}
+
 /**
  * @brief Constructs a BattleManager and initializes core systems.
  */
-BattleManager::BattleManager() {
+BattleManager::BattleManager()
+    : entityPool(world), turnSystem(world),
+      livingEntities(world.query<const RosterSlot>()),
+      livingEnemies(world.query<const RosterSlot>()),
+      livingPlayers(world.query<const RosterSlot>()) {
+    livingEntities.with<Alive>();
+    livingEnemies.with<EnemyTeam, Alive>();
+    livingPlayers.with<PlayerTeam, Alive>();
+    world.insertResource<BattleRng>();
+    world.insertResource<JobSystem>();
     initializeSkills();
     setupEventHandlers();
 }
@@ -15,49 +40,39 @@ BattleManager::BattleManager() {
  * @brief Populates the skill registry with predefined combat abilities.
  */
 void BattleManager::initializeSkills() {
+    auto& availableSkills = world.insertResource<SkillRegistry>().skills;
     availableSkills["attack"] = SkillFactory::createAttackSkill();
     availableSkills["heal"] = SkillFactory::createHealSkill();
-    availableSkills["fireball"] = Skill("Fireball",
-        [](Entity& user, Entity& target) {
-            auto* userStats = user.getComponent<HealthComponent>();
-            auto* targetStats = target.getComponent<HealthComponent>();
-            if (userStats && targetStats && userStats->stats.mana >= 15) {
-                int damage = userStats->stats.attack * 2 - targetStats->stats.defense / 2;
-                damage = std::max(1, damage);
-                targetStats->stats.health -= damage;
-                userStats->stats.mana -= 15;
-                std::cout << "Fireball cast! " << damage << " fire damage to "
-                    << target.getComponent<TransformComponent>()->name << ".\n";
-            }
-            else if (userStats && userStats->stats.mana < 15) {
-                std::cout << "Not enough mana to cast Fireball!\n";
-            }
-        }, 15);
+    availableSkills["fireball"] = SkillFactory::createFireballSkill();
 }
 
 /**
  * @brief Configures event handlers for turn-based battle events.
  */
 void BattleManager::setupEventHandlers() {
-    // Event at the start of each turn
-    turnSystem.subscribeToTurnStart([this]() {
-        if (auto actor = turnSystem.getCurrentActor()) {
-            if (auto* healthComp = actor->getComponent<HealthComponent>()) {
-                // Mana regeneration each turn
-                healthComp->stats.mana = std::min(healthComp->stats.maxMana, healthComp->stats.mana + 5);
-            }
-        }
-        });
+    // Mana regeneration at the start of each turn
+    turnSystem.getTurnStartSystems().addSystem("mana regeneration", regenerateMana)
+        .writes<CombatState>()
+        .reads<CombatBaseStats, TurnCounter>();
 }
 
 /**
  * @brief Factory method for entity creation with proper component initialization.
  */
-Ref<Entity> BattleManager::createEntity(const std::string& name, Team team, const Stats& stats) {
-    auto entity = std::make_shared<Entity>();
-    entity->addComponent<TransformComponent>(name, team);
-    entity->addComponent<HealthComponent>(stats);
-    return entity;
+EntityId BattleManager::createEntity(const std::string& name, Team team, const Stats& stats) {
+    Entity entity(world, entityPool.acquire());
+    entity.addComponent<DisplayInfo>(name);
+    entity.addComponent<CombatState>(stats);
+    entity.addComponent<CombatBaseStats>(stats);
+    entity.addComponent<Alive>();
+    entity.addComponent<RosterSlot>(nextRosterSlot++);
+    if (team == Team::PLAYER) {
+        entity.addComponent<PlayerTeam>();
+    }
+    else {
+        entity.addComponent<EnemyTeam>();
+    }
+    return entity.getId();
 }
 
 /**
@@ -66,14 +81,60 @@ Ref<Entity> BattleManager::createEntity(const std::string& name, Team team, cons
 void BattleManager::addPlayer(const std::string& name, const Stats& stats) {
     auto entity = createEntity(name, Team::PLAYER, stats);
     allEntities.push_back(entity);
+    turnSystem.setParticipants(allEntities);
 }
 
 /**
  * @brief Creates and registers an enemy entity.
  */
 void BattleManager::addEnemy(const std::string& name, const Stats& stats) {
+    releaseDefeated();
     auto entity = createEntity(name, Team::ENEMY, stats);
     allEntities.push_back(entity);
+    turnSystem.setParticipants(allEntities);
+}
+
+/**
+ * @brief Creates and registers a wave of identical enemies in a single batch.
+ */
+void BattleManager::addEnemies(const std::string& name, const Stats& stats, size_t count) {
+    Prefab enemy;
+    enemy.add<DisplayInfo>(name)
+         .add<CombatState>(stats)
+         .add<CombatBaseStats>(stats)
+         .add<EnemyTeam>()
+         .add<Alive>()
+         .add<RosterSlot>(0u);
+
+    releaseDefeated();
+    std::vector<EntityId> wave = entityPool.spawnBatch(enemy, count);
+    for (EntityId entity : wave) {
+        world.getComponent<RosterSlot>(entity)->index = nextRosterSlot++;
+    }
+    allEntities.insert(allEntities.end(), wave.begin(), wave.end());
+    turnSystem.setParticipants(allEntities);
+}
+
+/**
+ * @brief Returns defeated enemies to the entity pool and drops them from the battle.
+ */
+void BattleManager::releaseDefeated() {
+    auto defeated = [this](EntityId id) {
+        return world.hasComponent<EnemyTeam>(id) && world.hasComponent<Dead>(id);
+    };
+
+    size_t before = allEntities.size();
+    for (EntityId id : allEntities) {
+        if (defeated(id)) {
+            entityPool.release(id);
+        }
+    }
+    allEntities.erase(std::remove_if(allEntities.begin(), allEntities.end(),
+        [this](EntityId id) { return !world.isAlive(id); }), allEntities.end());
+
+    if (allEntities.size() != before) {
+        turnSystem.setParticipants(allEntities);
+    }
 }
 
 /**
@@ -83,33 +144,46 @@ void BattleManager::startBattle() {
     turnSystem.initializeBattle(allEntities);
 }
 
+/**
+ * @brief Ends the current battle and releases every entity in bulk.
+ */
+void BattleManager::resetBattle() {
+    turnSystem.reset();
+    allEntities.clear();
+    entityPool.clear();
+    aiTarget = EntityId{};
+    nextRosterSlot = 0;
+    world.reset();
+}
+
 /**
  * @brief Executes a player-initiated action during their turn.
  */
-void BattleManager::executePlayerAction(const std::string& skillName, Ref<Entity> target) {
+void BattleManager::executePlayerAction(const std::string& skillName, EntityId target) {
     if (turnSystem.getCurrentState() != BattleState::PLAYER_CHOICE) {
         std::cout << "It's not time to act yet!\n";
         return;
     }
 
-    auto actor = turnSystem.getCurrentActor();
-    auto skillIt = availableSkills.find(skillName);
+    Entity actor(world, turnSystem.getCurrentActor());
+    Skill* skill = world.getResource<SkillRegistry>()->find(skillName);
 
-    if (skillIt == availableSkills.end()) {
+    if (!skill) {
         std::cout << "Skill not found!\n";
         return;
     }
 
-    if (target && target->getComponent<HealthComponent>()->isAlive) {
+    Entity targetEntity(world, target);
+    if (targetEntity.hasComponent<CombatState>() && targetEntity.hasComponent<Alive>()) {
         // Verify mana if the skill has cost
-        auto* actorHealth = actor->getComponent<HealthComponent>();
-        if (skillIt->second.getCost() > 0 && actorHealth->stats.mana < skillIt->second.getCost()) {
-            std::cout << "Not enough mana! You need " << skillIt->second.getCost() << " mana.\n";
+        auto* actorState = actor.readComponent<CombatState>();
+        if (skill->getCost() > 0 && actorState->mana < skill->getCost()) {
+            std::cout << "Not enough mana! You need " << skill->getCost() << " mana.\n";
             std::this_thread::sleep_for(std::chrono::seconds(2));
             return;
         }
 
-        skillIt->second.execute(*actor, *target);
+        skill->execute(actor, targetEntity, turnSystem.getCommandBuffer());
 
         // Advance to next state
         turnSystem.setState(BattleState::ACTION_EXECUTE);
@@ -125,37 +199,45 @@ void BattleManager::update() {
         std::cout << "The enemy is thinking...\n";
         std::this_thread::sleep_for(std::chrono::seconds(1));
 
-        auto enemy = turnSystem.getCurrentActor();
-        auto players = getPlayerEntities();
+        Entity enemy(world, turnSystem.getCurrentActor());
+
+        // Simple AI: attack player with lowest health (the first in the roster on ties),
+        // re-evaluated only when some health changed
+        bool healthChanged = !world.isAlive(aiTarget);
+        world.view<const CombatState>().eachChanged<const CombatState>(aiTargetTick,
+            [&](EntityId, const CombatState&) { healthChanged = true; });
 
-        // Simple AI: attack player with lowest health
-        Ref<Entity> target = nullptr;
-        for (auto& player : players) {
-            if (player->getComponent<HealthComponent>()->isAlive) {
-                if (!target || player->getComponent<HealthComponent>()->stats.health <
-                    target->getComponent<HealthComponent>()->stats.health) {
-                    target = player;
+        if (healthChanged) {
+            aiTarget = EntityId{};
+            const CombatState* lowestHealth = nullptr;
+            uint32_t lowestSlot = 0;
+            livingPlayers.each([&](EntityId player, const RosterSlot& slot) {
+                const CombatState* playerHealth = world.readComponent<CombatState>(player);
+                if (!lowestHealth || playerHealth->health < lowestHealth->health ||
+                    (playerHealth->health == lowestHealth->health && slot.index < lowestSlot)) {
+                    aiTarget = player;
+                    lowestHealth = playerHealth;
+                    lowestSlot = slot.index;
                 }
-            }
+            });
         }
+        aiTargetTick = world.advanceChangeTick();
 
-        if (target) {
+        EntityId target = aiTarget;
+        if (!target.isNull()) {
             // 70% chance for basic attack, 30% for fireball if has mana
-            std::random_device rd;
-            std::mt19937 gen(rd());
-            std::uniform_real_distribution<> dis(0.0, 1.0);
-
             std::string skillToUse = "attack";
-            auto* enemyHealth = enemy->getComponent<HealthComponent>();
+            auto* enemyState = enemy.readComponent<CombatState>();
 
-            if (dis(gen) > 0.7 && enemyHealth->stats.mana >= 15) {
+            if (world.getResource<BattleRng>()->roll() > 0.7 && enemyState->mana >= 15) {
                 skillToUse = "fireball";
             }
 
-            std::cout << turnSystem.getCurrentActor()->getComponent<TransformComponent>()->name
+            std::cout << enemy.readComponent<DisplayInfo>()->name
                 << " uses " << skillToUse << "!\n";
 
-            availableSkills[skillToUse].execute(*enemy, *target);
+            Entity targetEntity(world, target);
+            world.getResource<SkillRegistry>()->find(skillToUse)->execute(enemy, targetEntity, turnSystem.getCommandBuffer());
             std::this_thread::sleep_for(std::chrono::seconds(1));
         }
 
@@ -164,46 +246,39 @@ void BattleManager::update() {
 }
 
 /**
- * @brief Filters entities that are currently active in combat.
+ * @brief Lists the entities matched by a roster query, ordered by RosterSlot.
  */
-std::vector<Ref<Entity>> BattleManager::getAliveEntities() const {
-    std::vector<Ref<Entity>> alive;
-    for (const auto& entity : allEntities) {
-        if (entity->getComponent<HealthComponent>()->isAlive) {
-            alive.push_back(entity);
-        }
+std::vector<EntityId> BattleManager::inRosterOrder(Query<const RosterSlot>& query) {
+    // Defeats swap archetype rows, so storage order is not roster order
+    std::vector<std::pair<uint32_t, EntityId>> slots;
+    query.each([&](EntityId entity, const RosterSlot& slot) { slots.emplace_back(slot.index, entity); });
+    std::sort(slots.begin(), slots.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<EntityId> entities;
+    entities.reserve(slots.size());
+    for (const auto& [index, entity] : slots) {
+        entities.push_back(entity);
     }
-    return alive;
+    return entities;
+}
+
+/**
+ * @brief Filters entities that are currently active in combat.
+ */
+std::vector<EntityId> BattleManager::getAliveEntities() const {
+    return inRosterOrder(livingEntities);
 }
 
 /**
  * @brief Filters entities belonging to the enemy team.
  */
-std::vector<Ref<Entity>> BattleManager::getEnemyEntities() const {
-    std::vector<Ref<Entity>> enemies;
-    for (const auto& entity : allEntities) {
-        if (auto* transform = entity->getComponent<TransformComponent>()) {
-            if (transform->team == Team::ENEMY &&
-                entity->getComponent<HealthComponent>()->isAlive) {
-                enemies.push_back(entity);
-            }
-        }
-    }
-    return enemies;
+std::vector<EntityId> BattleManager::getEnemyEntities() const {
+    return inRosterOrder(livingEnemies);
 }
 
 /**
  * @brief Filters entities belonging to the player team.
  */
-std::vector<Ref<Entity>> BattleManager::getPlayerEntities() const {
-    std::vector<Ref<Entity>> players;
-    for (const auto& entity : allEntities) {
-        if (auto* transform = entity->getComponent<TransformComponent>()) {
-            if (transform->team == Team::PLAYER &&
-                entity->getComponent<HealthComponent>()->isAlive) {
-                players.push_back(entity);
-            }
-        }
-    }
-    return players;
+std::vector<EntityId> BattleManager::getPlayerEntities() const {
+    return inRosterOrder(livingPlayers);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "TurnSystem.h"
 #include "Skill.h"
+#include "EntityPool.h"
 #include <map>
 
 /**
@@ -18,14 +19,22 @@
   */
 class BattleManager {
 private:
+    World world;                                        ///< Archetype storage owning all entity components
+    EntityPool entityPool;                              ///< Recycles the slots of released entities
     TurnSystem turnSystem;                              ///< Manages turn order and battle state transitions
-    std::vector<Ref<Entity>> allEntities;              ///< Collection of all participating entities in the battle
-    std::map<std::string, Skill> availableSkills;      ///< Registry of combat skills mapped by identifier
+    std::vector<EntityId> allEntities;                 ///< Collection of all participating entities in the battle
+    EntityId aiTarget;                                  ///< Player the enemy AI last chose to attack
+    uint32_t nextRosterSlot{ 0 };                       ///< RosterSlot given to the next entity joining the battle
+    mutable Query<const RosterSlot> livingEntities;     ///< Cached query: entities tagged Alive
+    mutable Query<const RosterSlot> livingEnemies;      ///< Cached query: entities tagged Alive and EnemyTeam
+    mutable Query<const RosterSlot> livingPlayers;      ///< Cached query: entities tagged Alive and PlayerTeam
+    Tick aiTargetTick{ 0 };                             ///< Change tick closed when aiTarget was chosen
 
 public:
     /**
      * @brief Constructs a BattleManager and initializes core systems.
-     * @details Automatically sets up skill registry and event handlers upon construction.
+     * @details Automatically sets up the world's battle resources (skill registry, RNG) and event handlers
+     *          upon construction.
      */
     BattleManager();
 
@@ -44,6 +53,21 @@ public:
      */
     void addEnemy(const std::string& name, const Stats& stats);
 
+    /**
+     * @brief Creates and registers a wave of identical enemies in a single batch.
+     * @param name The display name shared by every enemy in the wave.
+     * @param stats The combat statistics shared by every enemy in the wave.
+     * @param count Number of enemies to spawn.
+     */
+    void addEnemies(const std::string& name, const Stats& stats, size_t count);
+
+    /**
+     * @brief Returns defeated enemies to the entity pool and drops them from the battle.
+     * @details Called automatically before new enemies are added, so each wave reuses the slots and
+     *          component storage of the previous one instead of growing the world.
+     */
+    void releaseDefeated();
+
     // Battle Flow Control
     /**
      * @brief Initializes and starts a new battle sequence.
@@ -51,13 +75,20 @@ public:
      */
     void startBattle();
 
+    /**
+     * @brief Ends the current battle and releases every entity in bulk.
+     * @details The world's component storage is handed back to its arena at once. Subsequent addPlayer/addEnemy
+     *          calls populate a fresh battle.
+     */
+    void resetBattle();
+
     /**
      * @brief Executes a player-initiated action during their turn.
      * @param skillName The identifier of the skill to execute.
      * @param target The recipient entity of the skill effect (defaults to automatic selection).
      * @throws std::runtime_error if action execution violates turn rules or resource constraints.
      */
-    void executePlayerAction(const std::string& skillName, Ref<Entity> target = nullptr);
+    void executePlayerAction(const std::string& skillName, EntityId target = EntityId{});
 
     /**
      * @brief Updates battle state and processes non-player entity actions.
@@ -80,58 +111,80 @@ public:
 
     /**
      * @brief Gets the entity currently permitted to take actions.
-     * @return Shared pointer to the active entity, or nullptr if no entity is active.
+     * @return Handle of the active entity, or a null handle if no entity is active.
      */
-    Ref<Entity> getCurrentActor() const { return turnSystem.getCurrentActor(); }
+    EntityId getCurrentActor() const { return turnSystem.getCurrentActor(); }
+
+    /**
+     * @brief Provides the buffer for structural changes that must wait until the current turn ends.
+     * @return Reference to the turn system's command buffer.
+     */
+    CommandBuffer& getCommandBuffer() { return turnSystem.getCommandBuffer(); }
+
+    /**
+     * @brief Binds an entity ID to a component-access handle.
+     * @param id The generational ID of the entity.
+     * @return Entity handle forwarding to this battle's world.
+     */
+    Entity getEntity(EntityId id) { return Entity(world, id); }
+
+    /**
+     * @brief Closes the world's current change tick.
+     * @return Tick to pass to Entity::isChanged or View::eachChanged on the next pass to see only later changes.
+     */
+    Tick advanceChangeTick() { return world.advanceChangeTick(); }
 
     /**
      * @brief Provides access to all registered battle entities.
      * @return Constant reference to the collection of all entities.
      */
-    const std::vector<Ref<Entity>>& getEntities() const { return allEntities; }
+    const std::vector<EntityId>& getEntities() const { return allEntities; }
 
     /**
      * @brief Provides access to the available skill registry.
      * @return Constant reference to the map of skill identifiers to Skill objects.
      */
-    const std::map<std::string, Skill>& getSkills() const { return availableSkills; }
+    const std::map<std::string, Skill>& getSkills() const { return world.getResource<SkillRegistry>()->skills; }
 
     // Convenience Accessors
     /**
      * @brief Retrieves all player-aligned entities.
      * @return Vector containing all entities belonging to the player team.
      */
-    std::vector<Ref<Entity>> getPlayers() const { return getPlayerEntities(); }
+    std::vector<EntityId> getPlayers() const { return getPlayerEntities(); }
 
     /**
      * @brief Retrieves all enemy-aligned entities.
      * @return Vector containing all entities belonging to the enemy team.
      */
-    std::vector<Ref<Entity>> getEnemies() const { return getEnemyEntities(); }
+    std::vector<EntityId> getEnemies() const { return getEnemyEntities(); }
 
     // Utility Methods
     /**
      * @brief Filters entities that are currently active in combat.
-     * @return Vector containing only entities with positive health status.
+     * @return Vector containing only entities tagged Alive, in roster order.
      */
-    std::vector<Ref<Entity>> getAliveEntities() const;
+    std::vector<EntityId> getAliveEntities() const;
 
     /**
      * @brief Filters entities belonging to the enemy team.
-     * @return Vector containing only entities with Team::ENEMY alignment.
+     * @return Vector containing only living entities tagged EnemyTeam, in roster order.
+     * @details Reads the cached query, so the cost grows with the living enemies rather than the roster. The
+     *          order comes from RosterSlot and stays stable as entities change archetype, so UI panels do not
+     *          shuffle when someone is defeated.
      */
-    std::vector<Ref<Entity>> getEnemyEntities() const;
+    std::vector<EntityId> getEnemyEntities() const;
 
     /**
      * @brief Filters entities belonging to the player team.
-     * @return Vector containing only entities with Team::PLAYER alignment.
+     * @return Vector containing only living entities tagged PlayerTeam, in roster order.
      */
-    std::vector<Ref<Entity>> getPlayerEntities() const;
+    std::vector<EntityId> getPlayerEntities() const;
 
 private:
     /**
      * @brief Populates the skill registry with predefined combat abilities.
-     * @details Called during construction to initialize availableSkills map.
+     * @details Called during construction to insert the world's SkillRegistry resource.
      */
     void initializeSkills();
 
@@ -146,7 +199,14 @@ private:
      * @param name The display name for the new entity.
      * @param team The team alignment for the new entity.
      * @param stats The combat statistics for the new entity.
-     * @return Shared pointer to the fully constructed entity.
+     * @return Generational ID of the fully constructed entity.
+     */
+    EntityId createEntity(const std::string& name, Team team, const Stats& stats);
+
+    /**
+     * @brief Lists the entities matched by a roster query, ordered by RosterSlot.
+     * @param query One of the cached living entity queries.
+     * @return The matching entities in roster order.
      */
-    Ref<Entity> createEntity(const std::string& name, Team team, const Stats& stats);
+    static std::vector<EntityId> inRosterOrder(Query<const RosterSlot>& query);
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+#include "GameTypes.h"
+#include "Skill.h"
+#include <map>
+#include <random>
+#include <string>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: BattleResources.h
+ * @brief: Battle-global state stored as World resources.
+ * @details: State that belongs to the battle rather than to any entity lives in the World as a singleton
+ *           resource. Systems reach it with world.getResource<T>() in O(1), so they can be written as free
+ *           functions over the World instead of capturing TurnSystem or BattleManager.
+ */
+
+ /**
+  * @brief Random number generator shared by every system that rolls dice (AI decisions, critical hits...).
+  * @details One engine per battle instead of seeding a new one on every roll; pass a fixed seed to replay
+  *          a battle deterministically.
+  */
+struct BattleRng {
+    std::mt19937 engine;    ///< Engine every roll is drawn from
+
+    BattleRng() : engine(std::random_device{}()) {}
+    explicit BattleRng(uint32_t seed) : engine(seed) {}
+
+    /**
+     * @brief Draws a uniformly distributed value in [0, 1).
+     * @return The rolled value.
+     */
+    double roll() {
+        return std::uniform_real_distribution<>(0.0, 1.0)(engine);
+    }
+};
+
+/**
+ * @brief Current phase of the battle's state machine and the entity allowed to act.
+ */
+struct BattleStatus {
+    BattleState state{ BattleState::TURN_START };   ///< Current phase of battle execution
+    EntityId currentActor;                          ///< Entity currently permitted to take actions
+};
+
+/**
+ * @brief Counts the turns and rounds played in the current battle.
+ */
+struct TurnCounter {
+    uint32_t turn{ 0 };         ///< Turns started since the battle began
+    uint32_t round{ 0 };        ///< Times the turn order was recalculated
+    uint32_t roundStart{ 0 };   ///< Turn number of the first turn of the current round
+};
+
+/**
+ * @brief Registry of the combat skills available in the battle, mapped by identifier.
+ */
+struct SkillRegistry {
+    std::map<std::string, Skill> skills;    ///< Skills by identifier (e.g. "attack", "heal")
+
+    /**
+     * @brief Looks up a skill by identifier.
+     * @param name The skill identifier.
+     * @return Pointer to the skill, or nullptr if no skill is registered under that name.
+     */
+    Skill* find(const std::string& name) {
+        auto it = skills.find(name);
+        return it != skills.end() ? &it->second : nullptr;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+#include "World.h"
+#include <functional>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: CommandBuffer.h
+ * @brief: Deferred structural changes for safe mutation while systems iterate packed storage.
+ * @details: Adding or removing components and destroying entities moves rows between archetype columns and
+ *           swap-and-pops pools, which invalidates references held by a running view. Systems record those
+ *           changes in a CommandBuffer instead, and the buffer applies them in one batch at a sync point.
+ */
+
+ /**
+  * @brief Records spawn/destroy/add/remove operations and applies them to a World on flush().
+  * @details Commands run in the order they were recorded. Spawning only reserves the entity's handle, so
+  *          later commands in the same pass can target it; the entity itself is created at flush time, and
+  *          until then World::isAlive reports it as not alive. Commands aimed at entities destroyed before
+  *          the flush are ignored by the World's stale-handle checks.
+  */
+class CommandBuffer {
+private:
+    World& world;                                       ///< World the commands are applied to
+    std::vector<std::function<void(World&)>> commands;  ///< Pending structural changes, in record order
+    std::vector<EntityId> reserved;                     ///< Handles of pending spawns, released by clear()
+
+public:
+    /**
+     * @brief Constructs an empty buffer targeting the given world.
+     * @param target The world that flush() applies commands to.
+     */
+    explicit CommandBuffer(World& target) : world(target) {}
+
+    /**
+     * @brief Records the creation of a new, empty entity.
+     * @return Handle the entity will have, usable right away as the target of further recorded commands.
+     */
+    EntityId spawn() {
+        EntityId entity = world.reserveEntity();
+        reserved.push_back(entity);
+        commands.push_back([entity](World& target) { target.createReservedEntity(entity); });
+        return entity;
+    }
+
+    /**
+     * @brief Records the destruction of an entity.
+     * @param entity The entity to destroy at flush time.
+     */
+    void destroy(EntityId entity) {
+        commands.push_back([entity](World& target) { target.destroyEntity(entity); });
+    }
+
+    /**
+     * @brief Records adding a component to an entity.
+     * @tparam T The component type to add.
+     * @tparam Args Constructor argument types.
+     * @param entity The entity receiving the component.
+     * @param args Forwarded arguments; the component is constructed now and moved into storage at flush time.
+     */
+    template<typename T, typename... Args>
+    void addComponent(EntityId entity, Args&&... args) {
+        commands.push_back([entity, component = T(std::forward<Args>(args)...)](World& target) mutable {
+            target.addComponent<T>(entity, std::move(component));
+            });
+    }
+
+    /**
+     * @brief Records removing a component from an entity.
+     * @tparam T The component type to remove.
+     * @param entity The entity losing the component.
+     */
+    template<typename T>
+    void removeComponent(EntityId entity) {
+        commands.push_back([entity](World& target) { target.removeComponent<T>(entity); });
+    }
+
+    /**
+     * @brief Applies every recorded command in order and empties the buffer.
+     * @note Commands recorded while flushing are kept for the next flush.
+     * @warning Must not be called while a view over the same world is being iterated.
+     */
+    void flush() {
+        std::vector<std::function<void(World&)>> pending;
+        pending.swap(commands);
+        reserved.clear();
+        for (auto& command : pending) {
+            command(world);
+        }
+    }
+
+    /**
+     * @brief Drops every pending command without applying it.
+     * @details Slots reserved by pending spawns are handed back to the world.
+     */
+    void clear() {
+        for (EntityId entity : reserved) {
+            world.releaseReservedEntity(entity);
+        }
+        reserved.clear();
+        commands.clear();
+    }
+
+    /**
+     * @brief Checks if there are pending commands.
+     * @return True if flush() would do nothing.
+     */
+    bool empty() const { return commands.empty(); }
+
+    /**
+     * @brief Retrieves the number of pending commands.
+     * @return Command count.
+     */
+    size_t size() const { return commands.size(); }
+};
\ No newline at end of file
@@ -1,54 +1,249 @@
 #pragma once
 #include "GameTypes.h"
+#include "Name.h"
 #include <string>
 #include <unordered_map>
+#include <type_traits>
+#include <array>
 
 /**
  * @Author: Miguel Angel Garcia Elizalde
  * @Date: October, 2025
  * @file: Component.h
  * @brief: Defines the Component system, a core pattern for building flexible game entities.
+ * @details: Components are data-only structures that label an Entity as possessing a particular set of attributes
+ *           or capabilities. They share no base class: the World stores them by value and constructs, relocates and
+ *           destroys them through type-erased ComponentTypeInfo, so components carry no vtable and plain-data ones
+ *           stay trivially copyable.
  */
 
- /**
-  * @brief Base interface for all components.
-  * @details Components are data-only structures that label an Entity as possessing a particular set of attributes or capabilities.
-  */
-struct IComponent {
-	virtual ~IComponent() = default;
+/**
+ * @brief Storage backends a component type can be kept in by the World.
+ */
+enum class StorageType {
+	Table,		///< Archetype columns (default): fastest iteration over entities sharing many components
+	SparseSet,	///< Per-type sparse-set pool: O(1) add/remove without moving the entity's other components
+	Tag			///< No payload: presence is archetype membership only (default for empty types)
+};
+
+/**
+ * @brief Selects the storage backend for a component type.
+ * @tparam T The component type.
+ * @details Specialize for a component to move it out of archetype columns into a sparse-set pool.
+ */
+template<typename T>
+struct ComponentStorage {
+	static constexpr StorageType type = std::is_empty_v<T> ? StorageType::Tag : StorageType::Table;
 };
 
 /**
- * @brief Component containing core identity and world-state information for an Entity.
+ * @brief Cold presentation data, only read when an entity is printed or rendered.
+ * @details The name is interned: entities sharing a name share one string, and the component stays plain data.
  */
-struct TransformComponent : IComponent 
-{
-	std::string name;
-	Team team;
+struct DisplayInfo {
+	NameId name;
 
-	TransformComponent(const std::string& entityName, Team entityTeam)
-		: name(entityName), team(entityTeam) { }
+	explicit DisplayInfo(NameId entityName)
+		: name(entityName) { }
+
+	explicit DisplayInfo(const std::string& entityName)
+		: name(entityName) { }
 };
 
 /**
- * @brief Component for entities that can participate in combat, managing health and stats.
+ * @brief Hot combat data: the values that change turn after turn.
+ * @details Kept apart from CombatBaseStats so the loops that run every turn (defeat checks, mana regeneration)
+ *          stream 8 bytes per entity instead of a whole Stats. Table stored like CombatBaseStats, so both sit
+ *          in the same archetype chunks and a view over the pair walks two columns in lockstep.
  */
-struct HealthComponent : IComponent {
-	Stats stats;
-	bool isAlive{true};
+struct CombatState {
+	int32_t health;		///< Current health points (0 = defeated)
+	int32_t mana;		///< Current mana points
 
-	explicit HealthComponent(const Stats& entityStats) : stats(entityStats) {}
+	explicit CombatState(const Stats& stats)
+		: health(stats.health), mana(stats.mana) { }
 };
 
 /**
- * @brief Component for managing turn-based battle state per entity.
+ * @brief Base combat attributes: read by skills and turn ordering, written only when an entity is created.
  */
-struct BattleComponent : IComponent {
-	//Flag to track if the entity has taken its action in the current turn.
-	bool hasActed{ false };
+struct CombatBaseStats {
+	int32_t maxHealth;	///< Maximum health points
+	int32_t attack;		///< Base attack power for damage calculations
+	int32_t defense;	///< Damage reduction capability
+	int32_t speed;		///< Determines turn order (higher = acts sooner)
+	int32_t maxMana;	///< Maximum mana points
 
+	explicit CombatBaseStats(const Stats& stats)
+		: maxHealth(stats.maxHealth), attack(stats.attack), defense(stats.defense),
+		speed(stats.speed), maxMana(stats.maxMana) { }
+};
+
+/**
+ * @brief Component for managing turn-based battle state per entity.
+ */
+struct BattleComponent {
 	//Calculated value to determine action sequence (higher speed acts first).
 	int turnOrder{ 0 };
 
 	BattleComponent() = default;
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Position of an entity in the battle roster: the order it joined the battle.
+ * @details Archetype rows are reordered whenever an entity changes archetype, so lists shown to the player
+ *          and ties in target selection are ordered by this value instead of by storage order.
+ */
+struct RosterSlot {
+	uint32_t index;		///< Increases with every entity added to the battle; never reused
+
+	explicit RosterSlot(uint32_t slot)
+		: index(slot) { }
+};
+
+/**
+ * @brief Tag components: empty types whose presence is the whole information.
+ * @details Tags are stored as archetype membership only. They set a bit in the entity's mask and select its
+ *          archetype, but occupy no column and no per-entity bytes. Views filter on them with with<>() and
+ *          without<>(), which accepts or rejects whole archetypes at once.
+ */
+struct Alive {};		///< Entity can act and be targeted
+struct Dead {};			///< Entity was defeated
+struct PlayerTeam {};	///< Entity fights on the player's side
+struct EnemyTeam {};	///< Entity fights against the player
+
+static_assert(std::is_trivially_copyable_v<DisplayInfo> && std::is_trivially_copyable_v<CombatState> &&
+	std::is_trivially_copyable_v<CombatBaseStats> && std::is_trivially_copyable_v<BattleComponent> &&
+	std::is_trivially_copyable_v<RosterSlot>,
+	"Plain-data components must stay trivially copyable so storage can relocate and snapshot them with memcpy");
+
+/**
+ * @brief Dense identifier of a component type, usable as an array index or bit position.
+ */
+using ComponentId = uint32_t;
+
+/**
+ * @brief Compile-time list of component types.
+ * @tparam Ts The component types, in ID order.
+ */
+template<typename... Ts>
+struct ComponentList {
+	static constexpr size_t count = sizeof...(Ts);
+};
+
+/**
+ * @brief Every component type known to the World. A type's position in this list is its ComponentId.
+ * @note Append new component types at the end so existing IDs stay stable.
+ */
+using RegisteredComponents = ComponentList<DisplayInfo, CombatState, CombatBaseStats, BattleComponent,
+	Alive, Dead, PlayerTeam, EnemyTeam, RosterSlot>;
+
+/**
+ * @brief Number of registered component types (upper bound for ComponentId).
+ */
+inline constexpr size_t MaxComponents = RegisteredComponents::count;
+
+/**
+ * @brief Computes the position of T inside a ComponentList.
+ * @return Index of T, or the list size if T is not part of the list.
+ */
+template<typename T, typename... Ts>
+constexpr ComponentId indexOfComponent(ComponentList<Ts...>) {
+	ComponentId index = 0;
+	bool found = ((std::is_same_v<T, Ts> ? true : (++index, false)) || ...);
+	return found ? index : static_cast<ComponentId>(sizeof...(Ts));
+}
+
+/**
+ * @brief Compile-time ComponentId of T, resolved without RTTI.
+ * @tparam T A type listed in RegisteredComponents.
+ * @example
+ * @code
+ * static_assert(componentId<CombatState> == 1);
+ * @endcode
+ */
+template<typename T>
+inline constexpr ComponentId componentId = [] {
+	constexpr ComponentId id = indexOfComponent<T>(RegisteredComponents{});
+	static_assert(id < MaxComponents, "Component type must be added to RegisteredComponents");
+	return id;
+}();
+
+/**
+ * @brief Component signature: one bit per ComponentId, packed into 64-bit words.
+ * @details Used both per entity and per archetype. Presence tests are a single bit test and query matching
+ *          is a word-wise AND/compare, which compilers turn into plain integer (or SIMD) operations.
+ */
+struct ComponentMask {
+	static constexpr size_t WordCount = (MaxComponents + 63) / 64;
+
+	std::array<uint64_t, WordCount> words{};
+
+	constexpr void set(ComponentId id) { words[id / 64] |= uint64_t{ 1 } << (id % 64); }
+	constexpr void reset(ComponentId id) { words[id / 64] &= ~(uint64_t{ 1 } << (id % 64)); }
+	constexpr bool test(ComponentId id) const { return (words[id / 64] >> (id % 64)) & 1u; }
+
+	/**
+	 * @brief Checks if every bit of required is also set in this mask.
+	 * @param required The signature a query needs.
+	 * @return True if this mask is a superset of required.
+	 */
+	constexpr bool containsAll(const ComponentMask& required) const {
+		for (size_t i = 0; i < WordCount; ++i) {
+			if ((words[i] & required.words[i]) != required.words[i]) return false;
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Checks if this mask shares at least one bit with another.
+	 * @param other The signature to compare with, e.g. the types a query excludes.
+	 * @return True if any component is present in both masks.
+	 */
+	constexpr bool intersects(const ComponentMask& other) const {
+		for (size_t i = 0; i < WordCount; ++i) {
+			if (words[i] & other.words[i]) return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief Checks if no bit is set.
+	 * @return True for the signature of an entity without components.
+	 */
+	constexpr bool none() const {
+		for (uint64_t word : words) {
+			if (word) return false;
+		}
+		return true;
+	}
+
+	constexpr bool operator==(const ComponentMask& other) const { return words == other.words; }
+	constexpr bool operator<(const ComponentMask& other) const { return words < other.words; }
+};
+
+/**
+ * @brief Compile-time signature containing exactly the component types Ts.
+ * @tparam Ts Registered component types.
+ */
+template<typename... Ts>
+inline constexpr ComponentMask componentMask = [] {
+	ComponentMask mask;
+	(mask.set(componentId<std::remove_const_t<Ts>>), ...);
+	return mask;
+}();
+
+/**
+ * @brief Computes the signature of every tag component in a ComponentList.
+ */
+template<typename... Ts>
+constexpr ComponentMask tagMaskOf(ComponentList<Ts...>) {
+	ComponentMask mask;
+	((ComponentStorage<Ts>::type == StorageType::Tag ? mask.set(componentId<Ts>) : void()), ...);
+	return mask;
+}
+
+/**
+ * @brief Signature of every registered tag component. Archetypes allocate no column for these bits.
+ */
+inline constexpr ComponentMask tagComponents = tagMaskOf(RegisteredComponents{});
\ No newline at end of file
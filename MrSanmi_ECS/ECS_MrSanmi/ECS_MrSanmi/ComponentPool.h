@@ -0,0 +1,189 @@
+#pragma once
+#include "Component.h"
+#include <vector>
+#include <utility>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: ComponentPool.h
+ * @brief: Sparse-set component pools, an alternative storage backend to archetype columns.
+ * @details: A pool keeps a sparse array indexed by entity that points into a dense, packed array of
+ *           components. Adding, removing and testing a component are O(1), and systems can walk every
+ *           instance of a component type as a single contiguous array.
+ *           Pools are keyed by EntityIndex; generation checks happen in the World before a pool is touched.
+ *           Each component also carries the Tick of its last change, stored in a parallel dense array.
+ */
+
+/**
+ * @brief Type-erased interface over a sparse-set pool.
+ * @details Lets the World drop an entity from every pool without knowing the concrete component types.
+ */
+struct IComponentPool {
+    virtual ~IComponentPool() = default;
+
+    /**
+     * @brief Checks if the pool stores a component for an entity.
+     * @param entity The entity to look up.
+     * @return True if the entity has a component in this pool.
+     */
+    virtual bool contains(EntityIndex entity) const = 0;
+
+    /**
+     * @brief Removes an entity's component if present.
+     * @param entity The entity to remove.
+     */
+    virtual void remove(EntityIndex entity) = 0;
+};
+
+/**
+ * @brief Sparse-set storage for every instance of component T in a World.
+ * @tparam T The component type stored by this pool.
+ * @details sparse[entity] holds the position of the entity's component in the dense arrays. Removal moves
+ *          the last dense element into the freed slot (swap-and-pop), so the dense arrays never have holes.
+ */
+template<typename T>
+class ComponentPool : public IComponentPool {
+private:
+    static constexpr uint32_t npos = ~0u;   ///< Sparse marker for entities without a component
+
+    ArenaVector<uint32_t> sparse;           ///< Entity index to dense index (npos if absent)
+    ArenaVector<EntityId> denseEntities;    ///< Entity owning each dense slot
+    ArenaVector<T> dense;                   ///< Packed component values
+    ArenaVector<Tick> denseTicks;           ///< Tick of the last change of each packed component
+
+public:
+    /**
+     * @brief Constructs an empty pool allocating from the given memory resource.
+     * @param resource Memory resource backing the sparse and dense arrays (usually the World's arena).
+     */
+    explicit ComponentPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : sparse(resource), denseEntities(resource), dense(resource), denseTicks(resource) {
+    }
+
+    /**
+     * @brief Constructs a component for an entity in place.
+     * @tparam Args Constructor argument types.
+     * @param entity The entity receiving the component.
+     * @param args Forwarded arguments to the component's constructor.
+     * @return Reference to the stored component.
+     * @note Overwrites the existing component if the entity already has one.
+     */
+    template<typename... Args>
+    T& emplace(EntityId entity, Args&&... args) {
+        if (entity.index >= sparse.size()) {
+            sparse.resize(entity.index + 1, npos);
+        }
+
+        if (sparse[entity.index] != npos) {
+            denseEntities[sparse[entity.index]] = entity;
+            T& existing = dense[sparse[entity.index]];
+            existing = T(std::forward<Args>(args)...);
+            return existing;
+        }
+
+        sparse[entity.index] = static_cast<uint32_t>(dense.size());
+        denseEntities.push_back(entity);
+        denseTicks.push_back(0);
+        return dense.emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Checks if the pool stores a component for an entity.
+     * @param entity The entity to look up.
+     * @return True if the entity has a component in this pool.
+     */
+    bool contains(EntityIndex entity) const override {
+        return entity < sparse.size() && sparse[entity] != npos;
+    }
+
+    /**
+     * @brief Retrieves an entity's component.
+     * @param entity The entity to look up.
+     * @return Pointer to the component, or nullptr if the entity has none.
+     */
+    T* get(EntityIndex entity) {
+        return contains(entity) ? &dense[sparse[entity]] : nullptr;
+    }
+
+    /**
+     * @brief Read-only overload of get().
+     */
+    const T* get(EntityIndex entity) const {
+        return contains(entity) ? &dense[sparse[entity]] : nullptr;
+    }
+
+    /**
+     * @brief Removes an entity's component using swap-and-pop.
+     * @param entity The entity to remove.
+     * @warning Invalidates the pointer to the last component in the pool.
+     */
+    void remove(EntityIndex entity) override {
+        if (!contains(entity)) return;
+
+        uint32_t slot = sparse[entity];
+        uint32_t last = static_cast<uint32_t>(dense.size() - 1);
+        if (slot != last) {
+            dense[slot] = std::move(dense[last]);
+            denseEntities[slot] = denseEntities[last];
+            denseTicks[slot] = denseTicks[last];
+            sparse[denseEntities[slot].index] = slot;
+        }
+
+        dense.pop_back();
+        denseEntities.pop_back();
+        denseTicks.pop_back();
+        sparse[entity] = npos;
+    }
+
+    /**
+     * @brief Grows the dense arrays so that components can be added without reallocating.
+     * @param capacity Total number of components to make room for.
+     */
+    void reserve(size_t capacity) {
+        dense.reserve(capacity);
+        denseEntities.reserve(capacity);
+        denseTicks.reserve(capacity);
+    }
+
+    /**
+     * @brief Records that an entity's component changed.
+     * @param entity The entity whose component changed. Ignored if the pool has no entry for it.
+     * @param tick The World's current change tick.
+     */
+    void markChanged(EntityIndex entity, Tick tick) {
+        if (contains(entity)) {
+            denseTicks[sparse[entity]] = tick;
+        }
+    }
+
+    /**
+     * @brief Retrieves the tick of the last change to an entity's component.
+     * @param entity The entity to look up.
+     * @return Tick of the last change, or 0 if the pool has no entry for the entity.
+     */
+    Tick getChangeTick(EntityIndex entity) const {
+        return contains(entity) ? denseTicks[sparse[entity]] : 0;
+    }
+
+    /**
+     * @brief Retrieves the number of stored components.
+     * @return Dense element count.
+     */
+    size_t size() const { return dense.size(); }
+
+    /**
+     * @brief Provides the packed component array for linear iteration.
+     * @return Reference to the dense component vector.
+     */
+    ArenaVector<T>& components() { return dense; }
+
+    /**
+     * @brief Provides the entity owning each packed component.
+     * @return Constant reference to the dense entity vector, parallel to components().
+     */
+    const ArenaVector<EntityId>& entities() const { return denseEntities; }
+
+    typename ArenaVector<T>::iterator begin() { return dense.begin(); }
+    typename ArenaVector<T>::iterator end() { return dense.end(); }
+};
\ No newline at end of file
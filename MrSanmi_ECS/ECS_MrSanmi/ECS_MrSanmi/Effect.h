@@ -0,0 +1,369 @@
+#pragma once
+#include "World.h"
+#include "CommandBuffer.h"
+#include "DamageKernel.h"
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Effect.h
+ * @brief: Data-driven skill effects: a small stack bytecode and its interpreter.
+ * @details: An Effect is a plain list of instructions (load a stat, arithmetic, clamp, the basic attack formula,
+ *           compare and branch, apply damage or healing, spend mana, log) plus the text of its log lines. Unlike
+ *           a lambda it can be inspected, copied and stored as data. executeEffect() runs it directly against
+ *           the World's CombatState and CombatBaseStats storage, resolving each entity's components the first
+ *           time an instruction needs them; structural changes such as a defeat are recorded on a CommandBuffer
+ *           instead of applied.
+ *           EffectBuilder emits programs and resolves forward jumps.
+ */
+
+ /**
+  * @brief Entity an instruction refers to.
+  */
+enum class EffectSubject : uint8_t {
+    User,       ///< The entity using the skill
+    Target      ///< The entity receiving the skill
+};
+
+/**
+ * @brief Stat an instruction reads.
+ */
+enum class EffectStat : uint8_t {
+    Health,     ///< CombatState::health
+    Mana,       ///< CombatState::mana
+    MaxHealth,  ///< CombatBaseStats::maxHealth
+    MaxMana,    ///< CombatBaseStats::maxMana
+    Attack,     ///< CombatBaseStats::attack
+    Defense,    ///< CombatBaseStats::defense
+    Speed       ///< CombatBaseStats::speed
+};
+
+/**
+ * @brief Effect instruction set. Unless stated otherwise, operands are popped from and results pushed to the stack.
+ */
+enum class EffectOp : uint8_t {
+    Push,           ///< Pushes the instruction's value
+    LoadStat,       ///< Pushes a stat of the instruction's subject
+    IsAlive,        ///< Pushes 1 if the subject carries the Alive tag, 0 otherwise
+    Dup,            ///< Pushes a copy of the top value
+    Add,            ///< a + b
+    Sub,            ///< a - b
+    Mul,            ///< a * b
+    Div,            ///< a / b, truncating like C++; 0 if b is 0
+    Min,            ///< min(a, b)
+    Max,            ///< max(a, b)
+    Clamp,          ///< Pops value, low, high; pushes value clamped to [low, high]
+    AttackDamage,   ///< attackDamage(a, b): the basic attack formula with attack a and defense b
+    Less,           ///< 1 if a < b, 0 otherwise
+    Jump,           ///< Continues at the instruction index in value
+    JumpIfZero,     ///< Pops a condition; continues at the instruction index in value if it is 0
+    Damage,         ///< Pops an amount and subtracts it from the subject's health
+    Heal,           ///< Pops an amount, raises the subject's health up to its maximum, pushes the amount restored
+    SpendMana,      ///< Pops an amount and subtracts it from the subject's mana
+    DefeatIfDown,   ///< Records swapping the subject's Alive tag for Dead if its health is 0 or lower
+    Log,            ///< Prints message[value]; "{value}" takes a popped value and "{target}" the target's name
+    Return          ///< Ends the effect
+};
+
+/**
+ * @brief One effect instruction: 8 bytes, trivially copyable.
+ */
+struct EffectInstruction {
+    EffectOp op;                                    ///< Operation
+    EffectSubject subject{ EffectSubject::User };   ///< Entity the operation refers to, if any
+    EffectStat stat{ EffectStat::Health };          ///< Stat read by LoadStat
+    int32_t value{ 0 };                             ///< Constant, jump target or message index
+};
+
+/**
+ * @brief A compiled skill effect.
+ */
+struct Effect {
+    std::vector<EffectInstruction> code;    ///< Instructions, run from index 0 until Return or the end
+    std::vector<std::string> messages;      ///< Log line templates referenced by Log instructions
+
+    /**
+     * @brief Checks if the effect has no instructions.
+     */
+    bool empty() const { return code.empty(); }
+};
+
+/**
+ * @brief Emits Effect programs.
+ * @example
+ * @code
+ * EffectBuilder b;
+ * b.load(EffectSubject::User, EffectStat::Mana).push(10).op(EffectOp::Less);
+ * size_t enough = b.jumpIfZero();
+ * b.log("Not enough mana!").op(EffectOp::Return);
+ * b.bind(enough);
+ * ...
+ * Effect effect = b.build();
+ * @endcode
+ */
+class EffectBuilder {
+private:
+    Effect effect;  ///< Program being built
+
+public:
+    /**
+     * @brief Emits an instruction without operands.
+     */
+    EffectBuilder& op(EffectOp operation) {
+        effect.code.push_back({ operation });
+        return *this;
+    }
+
+    /**
+     * @brief Emits an instruction acting on a subject (IsAlive, Damage, Heal, SpendMana, DefeatIfDown).
+     */
+    EffectBuilder& op(EffectOp operation, EffectSubject subject) {
+        effect.code.push_back({ operation, subject });
+        return *this;
+    }
+
+    /**
+     * @brief Emits a Push of a constant.
+     */
+    EffectBuilder& push(int32_t value) {
+        effect.code.push_back({ EffectOp::Push, EffectSubject::User, EffectStat::Health, value });
+        return *this;
+    }
+
+    /**
+     * @brief Emits a LoadStat.
+     */
+    EffectBuilder& load(EffectSubject subject, EffectStat stat) {
+        effect.code.push_back({ EffectOp::LoadStat, subject, stat });
+        return *this;
+    }
+
+    /**
+     * @brief Emits a Log of a message template.
+     * @param message Text to print; "{value}" is replaced by a popped value and "{target}" by the target's name.
+     */
+    EffectBuilder& log(const std::string& message) {
+        effect.code.push_back({ EffectOp::Log, EffectSubject::User, EffectStat::Health,
+                                static_cast<int32_t>(effect.messages.size()) });
+        effect.messages.push_back(message);
+        return *this;
+    }
+
+    /**
+     * @brief Emits a JumpIfZero whose destination is set later with bind().
+     * @return Index of the jump instruction.
+     */
+    size_t jumpIfZero() {
+        effect.code.push_back({ EffectOp::JumpIfZero });
+        return effect.code.size() - 1;
+    }
+
+    /**
+     * @brief Emits a Jump whose destination is set later with bind().
+     * @return Index of the jump instruction.
+     */
+    size_t jump() {
+        effect.code.push_back({ EffectOp::Jump });
+        return effect.code.size() - 1;
+    }
+
+    /**
+     * @brief Makes a jump continue at the next instruction to be emitted.
+     * @param jumpIndex Index returned by jump() or jumpIfZero().
+     */
+    EffectBuilder& bind(size_t jumpIndex) {
+        effect.code[jumpIndex].value = static_cast<int32_t>(effect.code.size());
+        return *this;
+    }
+
+    /**
+     * @brief Retrieves the finished program.
+     */
+    Effect build() const { return effect; }
+};
+
+/**
+ * @brief Runs an effect.
+ * @param effect The program to run.
+ * @param world The world storing both entities' components.
+ * @param commands Receives the structural changes of the effect (DefeatIfDown's tag swap) until its next flush.
+ * @param user The entity using the skill.
+ * @param target The entity receiving the skill.
+ * @details An instruction that needs a CombatState or CombatBaseStats its subject does not own stops the effect,
+ *          as does a malformed program (stack underflow or overflow, jump out of range).
+ */
+inline void executeEffect(const Effect& effect, World& world, CommandBuffer& commands, EntityId user, EntityId target) {
+    constexpr size_t MaxStack = 16;
+
+    // Components are resolved on first use, at most once per run; no entity changes archetype while the effect runs
+    EntityId entities[2] = { user, target };
+    const CombatState* states[2] = { nullptr, nullptr };
+    const CombatBaseStats* bases[2] = { nullptr, nullptr };
+    auto state = [&](size_t subject) {
+        if (!states[subject]) states[subject] = world.readComponent<CombatState>(entities[subject]);
+        return states[subject];
+    };
+    auto base = [&](size_t subject) {
+        if (!bases[subject]) bases[subject] = world.readComponent<CombatBaseStats>(entities[subject]);
+        return bases[subject];
+    };
+
+    // The first write to a subject's state goes through getComponent, which records the change and notifies observers
+    CombatState* writable[2] = { nullptr, nullptr };
+    auto writableState = [&](size_t subject) {
+        if (!writable[subject]) {
+            writable[subject] = world.getComponent<CombatState>(entities[subject]);
+            states[subject] = writable[subject];
+        }
+        return writable[subject];
+    };
+
+    int32_t stack[MaxStack];
+    size_t size = 0;
+    size_t pc = 0;
+    while (pc < effect.code.size()) {
+        const EffectInstruction& instruction = effect.code[pc++];
+        size_t subject = static_cast<size_t>(instruction.subject);
+
+        switch (instruction.op) {
+        case EffectOp::Push:
+        case EffectOp::LoadStat:
+        case EffectOp::IsAlive:
+        case EffectOp::Dup:
+            if (size == MaxStack) return;
+            break;
+        case EffectOp::Add: case EffectOp::Sub: case EffectOp::Mul: case EffectOp::Div:
+        case EffectOp::Min: case EffectOp::Max: case EffectOp::Less: case EffectOp::AttackDamage:
+            if (size < 2) return;
+            break;
+        case EffectOp::Clamp:
+            if (size < 3) return;
+            break;
+        case EffectOp::JumpIfZero: case EffectOp::Damage: case EffectOp::Heal: case EffectOp::SpendMana:
+            if (size < 1) return;
+            break;
+        default:
+            break;
+        }
+
+        switch (instruction.op) {
+        case EffectOp::Push:
+            stack[size++] = instruction.value;
+            break;
+        case EffectOp::LoadStat: {
+            bool hot = instruction.stat == EffectStat::Health || instruction.stat == EffectStat::Mana;
+            const CombatState* hotStats = hot ? state(subject) : nullptr;
+            const CombatBaseStats* baseStats = hot ? nullptr : base(subject);
+            if (!hotStats && !baseStats) return;
+
+            int32_t stat = 0;
+            switch (instruction.stat) {
+            case EffectStat::Health: stat = hotStats->health; break;
+            case EffectStat::Mana: stat = hotStats->mana; break;
+            case EffectStat::MaxHealth: stat = baseStats->maxHealth; break;
+            case EffectStat::MaxMana: stat = baseStats->maxMana; break;
+            case EffectStat::Attack: stat = baseStats->attack; break;
+            case EffectStat::Defense: stat = baseStats->defense; break;
+            case EffectStat::Speed: stat = baseStats->speed; break;
+            }
+            stack[size++] = stat;
+            break;
+        }
+        case EffectOp::IsAlive:
+            stack[size++] = world.hasComponent<Alive>(entities[subject]) ? 1 : 0;
+            break;
+        case EffectOp::Dup:
+            if (size == 0) return;
+            stack[size] = stack[size - 1];
+            ++size;
+            break;
+        case EffectOp::Add: --size; stack[size - 1] += stack[size]; break;
+        case EffectOp::Sub: --size; stack[size - 1] -= stack[size]; break;
+        case EffectOp::Mul: --size; stack[size - 1] *= stack[size]; break;
+        case EffectOp::Div: --size; stack[size - 1] = stack[size] ? stack[size - 1] / stack[size] : 0; break;
+        case EffectOp::Min: --size; stack[size - 1] = std::min(stack[size - 1], stack[size]); break;
+        case EffectOp::Max: --size; stack[size - 1] = std::max(stack[size - 1], stack[size]); break;
+        case EffectOp::Less: --size; stack[size - 1] = stack[size - 1] < stack[size] ? 1 : 0; break;
+        case EffectOp::Clamp:
+            size -= 2;
+            stack[size - 1] = std::max(stack[size], std::min(stack[size + 1], stack[size - 1]));
+            break;
+        case EffectOp::AttackDamage: --size; stack[size - 1] = attackDamage(stack[size - 1], stack[size]); break;
+        case EffectOp::Jump:
+        case EffectOp::JumpIfZero:
+            if (instruction.op == EffectOp::JumpIfZero && stack[--size] != 0) break;
+            if (instruction.value < 0 || static_cast<size_t>(instruction.value) > effect.code.size()) return;
+            pc = static_cast<size_t>(instruction.value);
+            break;
+        case EffectOp::Damage: {
+            CombatState* hurt = writableState(subject);
+            if (!hurt) return;
+            hurt->health -= stack[--size];
+            break;
+        }
+        case EffectOp::Heal: {
+            const CombatBaseStats* limits = base(subject);
+            CombatState* healed = limits ? writableState(subject) : nullptr;
+            if (!healed) return;
+            int32_t before = healed->health;
+            healed->health = std::min(limits->maxHealth, healed->health + stack[size - 1]);
+            stack[size - 1] = healed->health - before;
+            break;
+        }
+        case EffectOp::SpendMana: {
+            CombatState* spender = writableState(subject);
+            if (!spender) return;
+            spender->mana -= stack[--size];
+            break;
+        }
+        case EffectOp::DefeatIfDown: {
+            const CombatState* current = state(subject);
+            if (!current) return;
+            // The subject keeps its Alive tag until the buffer is flushed
+            if (current->health <= 0 && world.hasComponent<Alive>(entities[subject])) {
+                std::cout << world.readComponent<DisplayInfo>(entities[subject])->name << " has been defeated!\n";
+                commands.removeComponent<Alive>(entities[subject]);
+                commands.addComponent<Dead>(entities[subject]);
+            }
+            break;
+        }
+        case EffectOp::Log: {
+            if (instruction.value < 0 || static_cast<size_t>(instruction.value) >= effect.messages.size()) return;
+            // Literal text between placeholders is written in whole runs
+            const std::string& message = effect.messages[instruction.value];
+            size_t i = 0;
+            while (i < message.size()) {
+                size_t brace = std::min(message.find('{', i), message.size());
+                std::cout.write(message.data() + i, static_cast<std::streamsize>(brace - i));
+                i = brace;
+                if (i == message.size()) break;
+
+                if (message.compare(i, 7, "{value}") == 0) {
+                    if (size == 0) return;
+                    std::cout << stack[--size];
+                    i += 7;
+                }
+                else if (message.compare(i, 8, "{target}") == 0) {
+                    if (const DisplayInfo* display = world.readComponent<DisplayInfo>(target)) {
+                        std::cout << display->name;
+                    }
+                    i += 8;
+                }
+                else {
+                    std::cout.put('{');
+                    ++i;
+                }
+            }
+            std::cout.put('\n');
+            break;
+        }
+        case EffectOp::Return:
+            return;
+        }
+    }
+}
\ No newline at end of file
@@ -1,7 +1,6 @@
 #pragma once
-#include "Component.h"
-#include <typeindex>
-#include <unordered_map>
+#include "World.h"
+#include "View.h"
 
 /**
  * @Author: Miguel Angel Garcia Elizalde
@@ -12,51 +11,107 @@
  */
 
  /**
-  * @brief Container class for components in the Entity-Component-System architecture.
+  * @brief Lightweight handle to an entity stored in a World.
   * @details Entities are simple identifiers that aggregate components. They contain no logic themselves,
   *          but serve as handles to collections of data components that systems operate upon.
-  *          This implementation uses type-safe component storage with runtime type identification.
+  *          Component data lives in the World's storage; the handle is a trivially copyable
+  *          (World*, EntityId) pair that only forwards requests.
   */
 class Entity {
 private:
-    /// Type-indexed map storing component instances with ownership
-    std::unordered_map<std::type_index, std::unique_ptr<IComponent>> components;
+    World* world{ nullptr };    ///< World owning this entity's component data
+    EntityId id;                ///< Generational handle of this entity inside the world
 
 public:
+    /**
+     * @brief Default constructor for Entity.
+     * @details Creates a null handle that is not bound to any world.
+     */
+    Entity() = default;
+
+    /**
+     * @brief Creates a new, empty entity inside the given world.
+     * @param owner The world that will store this entity's components.
+     */
+    explicit Entity(World& owner)
+        : world(&owner), id(owner.createEntity()) {
+    }
+
+    /**
+     * @brief Binds a handle to an existing entity.
+     * @param owner The world storing the entity.
+     * @param entityId The entity's generational ID.
+     */
+    Entity(World& owner, EntityId entityId)
+        : world(&owner), id(entityId) {
+    }
+
     /**
      * @brief Adds a component of specified type to the entity.
-     * @tparam T The component type to add (must inherit from IComponent).
+     * @tparam T The component type to add (must be listed in RegisteredComponents).
      * @tparam Args Variadic template parameter pack for component constructor arguments.
      * @param args Forwarded arguments to the component's constructor.
      * @note Overwrites existing component of the same type if present.
      * @example
      * @code
-     * entity.addComponent<TransformComponent>("Player", Team::PLAYER);
-     * entity.addComponent<HealthComponent>(Stats{100, 10, 5, 15, 50});
+     * Stats stats{100, 10, 5, 15, 50};
+     * entity.addComponent<DisplayInfo>("Player");
+     * entity.addComponent<CombatState>(stats);
+     * entity.addComponent<CombatBaseStats>(stats);
+     * entity.addComponent<PlayerTeam>();
      * @endcode
      */
     template<typename T, typename... Args>
     void addComponent(Args&&... args) {
-        components[std::type_index(typeid(T))] =
-            std::make_unique<T>(std::forward<Args>(args)...);
+        world->addComponent<T>(id, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Retrieves a component of specified type from the entity.
-     * @tparam T The component type to retrieve (must inherit from IComponent).
+     * @brief Removes a component of specified type from the entity.
+     * @tparam T The component type to remove.
+     * @warning Invalidates previously obtained component pointers of this entity.
+     */
+    template<typename T>
+    void removeComponent() {
+        world->removeComponent<T>(id);
+    }
+
+    /**
+     * @brief Retrieves a component of specified type from the entity for modification.
+     * @tparam T The component type to retrieve (must be listed in RegisteredComponents).
      * @return Raw pointer to the component if found, nullptr otherwise.
-     * @warning Returns non-owning pointer. Component lifetime is managed by the entity.
+     * @details Marks the component as changed at the world's current tick; use readComponent() for reads.
+     * @warning Returns non-owning pointer into world storage. Structural changes may invalidate it.
      * @example
      * @code
-     * auto* health = entity.getComponent<HealthComponent>();
-     * if (health && health->isAlive) { /* process living entity *\/ }
+     * auto* state = entity.getComponent<CombatState>();
+     * if (state && entity.hasComponent<Alive>()) { /* process living entity *\/ }
      * @endcode
      */
     template<typename T>
     T* getComponent() {
-        auto it = components.find(std::type_index(typeid(T)));
-        return it != components.end() ?
-            static_cast<T*>(it->second.get()) : nullptr;
+        return world->getComponent<T>(id);
+    }
+
+    /**
+     * @brief Retrieves a component of specified type without marking it as changed.
+     * @tparam T The component type to retrieve.
+     * @return Read-only pointer to the component if found, nullptr otherwise.
+     */
+    template<typename T>
+    const T* readComponent() const {
+        return world->readComponent<T>(id);
+    }
+
+    /**
+     * @brief Checks if a component was added or modified after a given tick.
+     * @tparam T The component type to check.
+     * @param since Tick the caller last observed (see World::advanceChangeTick).
+     * @return True if the entity owns T and it changed after since.
+     */
+    template<typename T>
+    bool isChanged(Tick since) const {
+        return world->isChanged<T>(id, since);
     }
 
     /**
@@ -65,14 +120,14 @@ public:
      * @return True if the component is present, false otherwise.
      * @example
      * @code
-     * if (entity.hasComponent<TransformComponent>()) {
-     *     // Entity has transform data
+     * if (entity.hasComponent<DisplayInfo>()) {
+     *     // Entity can be displayed
      * }
      * @endcode
      */
     template<typename T>
     bool hasComponent() const {
-        return components.find(std::type_index(typeid(T))) != components.end();
+        return world->hasComponent<T>(id);
     }
 
     /**
@@ -81,7 +136,7 @@ public:
      * @warning Invalidates all previously obtained component pointers.
      */
     void clearComponents() {
-        components.clear();
+        world->clearComponents(id);
     }
 
     /**
@@ -90,6 +145,26 @@ public:
      * @note Empty entities are typically invalid and should not be processed by systems.
      */
     bool isEmpty() const {
-        return components.empty();
+        return world->isEmpty(id);
+    }
+
+    /**
+     * @brief Checks if the handle refers to a live entity.
+     * @return False for null handles and for entities destroyed since the handle was created.
+     */
+    bool isValid() const {
+        return world && world->isAlive(id);
     }
+
+    /**
+     * @brief Retrieves the generational ID of this entity.
+     * @return The entity ID.
+     */
+    EntityId getId() const { return id; }
+
+    /**
+     * @brief Retrieves the world owning this entity's component data.
+     * @return The world, or nullptr for a default-constructed handle.
+     */
+    World* getWorld() const { return world; }
 };
\ No newline at end of file
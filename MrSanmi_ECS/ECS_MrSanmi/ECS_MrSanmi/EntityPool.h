@@ -0,0 +1,105 @@
+#pragma once
+#include "Prefab.h"
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: EntityPool.h
+ * @brief: Free-list pool that recycles entities instead of creating new ones.
+ * @details: Released entities are stripped with World::recycleEntity (clearComponents plus a generation bump)
+ *           and kept in a free list. Their slots stay reserved, and the columns and pools they left keep their
+ *           capacity, so waves of enemies spawned after earlier ones were defeated reuse the same memory.
+ */
+
+ /**
+  * @brief Recycles entity slots of a World across waves and battles.
+  * @example
+  * @code
+  * EntityPool pool(world);
+  * EntityId goblin = pool.acquire();
+  * world.addComponent<CombatState>(goblin, Stats(10));
+  * pool.release(goblin);              // goblin is now stale
+  * EntityId reused = pool.acquire();  // same slot, new generation
+  * @endcode
+  */
+class EntityPool {
+private:
+    World& world;                    ///< World owning the pooled entities
+    std::vector<EntityId> available; ///< Emptied entities ready to be handed out, most recent last
+
+public:
+    /**
+     * @brief Constructs an empty pool over a world.
+     * @param owner The world whose entities are recycled.
+     */
+    explicit EntityPool(World& owner) : world(owner) {}
+
+    EntityPool(const EntityPool&) = delete;
+    EntityPool& operator=(const EntityPool&) = delete;
+
+    /**
+     * @brief Hands out an empty entity, recycling a released one when available.
+     * @return Handle to an alive entity with no components.
+     */
+    EntityId acquire() {
+        while (!available.empty()) {
+            EntityId entity = available.back();
+            available.pop_back();
+            if (world.isAlive(entity)) return entity;
+        }
+        return world.createEntity();
+    }
+
+    /**
+     * @brief Returns an entity to the pool.
+     * @param entity The entity to release. Stale handles are ignored.
+     * @details The entity loses all of its components and every outstanding handle to it becomes stale.
+     */
+    void release(EntityId entity) {
+        EntityId recycled = world.recycleEntity(entity);
+        if (!recycled.isNull()) {
+            available.push_back(recycled);
+        }
+    }
+
+    /**
+     * @brief Spawns count entities from a prefab, reusing released entities first.
+     * @param prefab Component values every entity starts with.
+     * @param count Number of entities to spawn.
+     * @return Handles of the spawned entities.
+     * @details Recycled entities are populated one by one; the remainder, if any, is bulk-spawned with
+     *          World::spawnBatch.
+     */
+    std::vector<EntityId> spawnBatch(const Prefab& prefab, size_t count) {
+        std::vector<EntityId> spawned;
+        spawned.reserve(count);
+
+        while (spawned.size() < count && !available.empty()) {
+            EntityId entity = available.back();
+            available.pop_back();
+            if (!world.isAlive(entity)) continue;
+
+            prefab.instantiate(world, entity);
+            spawned.push_back(entity);
+        }
+
+        if (spawned.size() < count) {
+            std::vector<EntityId> fresh = world.spawnBatch(prefab, count - spawned.size());
+            spawned.insert(spawned.end(), fresh.begin(), fresh.end());
+        }
+        return spawned;
+    }
+
+    /**
+     * @brief Retrieves the number of entities waiting to be reused.
+     * @return Size of the free list.
+     */
+    size_t size() const { return available.size(); }
+
+    /**
+     * @brief Forgets every pooled entity.
+     * @details Call before World::reset, which frees the pooled slots itself.
+     */
+    void clear() { available.clear(); }
+};
\ No newline at end of file
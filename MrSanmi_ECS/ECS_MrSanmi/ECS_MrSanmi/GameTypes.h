@@ -3,6 +3,10 @@
 #include <cstdint>
 #include <vector>
 #include <functional>
+#include <memory_resource>
+#include <limits>
+#include <stdexcept>
+#include <string>
 
 /**
  * @Author: Miguel Angel Garcia Elizalde
@@ -28,10 +32,57 @@ using Scope = std::unique_ptr<T>;
 template<typename T>
 using Ref = std::shared_ptr<T>;
 
+/**
+ * @brief Vector whose storage comes from a polymorphic memory resource.
+ * @tparam T The element type.
+ * @details Equivalent to std::pmr::vector<T>. Used by World storage so every component array is carved out
+ *          of the world's arena and can be released in bulk.
+ */
+template<typename T>
+using ArenaVector = std::pmr::vector<T>;
+
+/**
+ * @brief Slot index of an entity inside its owning World.
+ */
+using EntityIndex = uint32_t;
+
+/**
+ * @brief Value of a World's change counter.
+ * @details Every component remembers the tick of its last change, so systems can skip components that were
+ *          not touched since the tick they last observed.
+ */
+using Tick = uint32_t;
+
+/**
+ * @brief Generational handle identifying an entity.
+ * @details Packs a slot index and the generation the slot had when the entity was created into 64 bits.
+ *          Destroying an entity bumps its slot's generation, so any handle still pointing at the old
+ *          generation is detected as stale by the World. Handles are trivially copyable values.
+ */
+struct EntityId {
+    static constexpr EntityIndex InvalidIndex = ~0u;   ///< Index used by null handles
+
+    EntityIndex index{ InvalidIndex };  ///< Slot in the World's entity records
+    uint32_t generation{ 0 };           ///< Slot generation this handle was issued for
+
+    /**
+     * @brief Checks if the handle was ever issued (it may still be stale).
+     * @return False for default-constructed handles.
+     */
+    bool isNull() const { return index == InvalidIndex; }
+
+    bool operator==(const EntityId& other) const {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const EntityId& other) const { return !(*this == other); }
+};
+
 /**
  * @brief Comprehensive statistical attributes for game entities.
  * @details Contains all numerical values that define an entity's combat capabilities and current state.
- *          Used by systems such as combat, AI, and UI rendering.
+ *          Used to describe combatants; entities store it split into the hot CombatState and the
+ *          rarely-changing CombatBaseStats components (see Component.h).
  */
 struct Stats {
     int32_t health;         ///< Current health points (0 = defeated)
@@ -58,6 +109,135 @@ struct Stats {
     }
 };
 
+/**
+ * @brief Narrows a stat value to a smaller integer type, rejecting values that do not fit.
+ * @tparam T Target integer type.
+ * @param value The stat value.
+ * @param field Name of the stat, for the error message.
+ * @return The value as T.
+ * @throws std::out_of_range if value is outside T's range.
+ */
+template<typename T>
+T narrowStat(int32_t value, const char* field) {
+    if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max()) {
+        throw std::out_of_range(std::string("Stats::") + field + " = " + std::to_string(value) +
+                                " does not fit the packed stat type");
+    }
+    return static_cast<T>(value);
+}
+
+/**
+ * @brief Compact copy of Stats with 16-bit fields, half the size of Stats.
+ * @details For memory-bound simulations over very large rosters. Conversion from Stats is checked: a value
+ *          outside the int16_t range throws instead of silently wrapping. Conversion back is lossless.
+ */
+struct PackedStats {
+    int16_t health;         ///< Current health points
+    int16_t maxHealth;      ///< Maximum health points
+    int16_t attack;         ///< Base attack power
+    int16_t defense;        ///< Damage reduction
+    int16_t speed;          ///< Turn order value
+    int16_t mana;           ///< Current mana points
+    int16_t maxMana;        ///< Maximum mana points
+
+    /**
+     * @brief Packs a Stats value.
+     * @param stats The stats to pack.
+     * @throws std::out_of_range if any field does not fit in 16 bits.
+     */
+    explicit PackedStats(const Stats& stats)
+        : health(narrowStat<int16_t>(stats.health, "health")),
+        maxHealth(narrowStat<int16_t>(stats.maxHealth, "maxHealth")),
+        attack(narrowStat<int16_t>(stats.attack, "attack")),
+        defense(narrowStat<int16_t>(stats.defense, "defense")),
+        speed(narrowStat<int16_t>(stats.speed, "speed")),
+        mana(narrowStat<int16_t>(stats.mana, "mana")),
+        maxMana(narrowStat<int16_t>(stats.maxMana, "maxMana")) {
+    }
+
+    /**
+     * @brief Widens the packed values back into a Stats.
+     */
+    Stats unpack() const {
+        Stats stats;
+        stats.health = health;
+        stats.maxHealth = maxHealth;
+        stats.attack = attack;
+        stats.defense = defense;
+        stats.speed = speed;
+        stats.mana = mana;
+        stats.maxMana = maxMana;
+        return stats;
+    }
+};
+
+static_assert(sizeof(PackedStats) == sizeof(Stats) / 2, "PackedStats should stay half the size of Stats");
+
+/**
+ * @brief Structure-of-arrays storage for the Stats of many combatants.
+ * @tparam T Integer type of every column: int32_t for full Stats, int16_t for packed ones.
+ * @details Each attribute is its own packed column, so kernels that only need attack and defense stream
+ *          two arrays instead of striding over whole Stats structs. Used by mass battle resolution;
+ *          see DamageKernel.h.
+ */
+template<typename T>
+struct BasicStatsColumns {
+    std::vector<T> health;          ///< Current health points
+    std::vector<T> maxHealth;       ///< Maximum health points
+    std::vector<T> attack;          ///< Base attack power
+    std::vector<T> defense;         ///< Damage reduction
+    std::vector<T> speed;           ///< Turn order value
+    std::vector<T> mana;            ///< Current mana points
+    std::vector<T> maxMana;         ///< Maximum mana points
+
+    /**
+     * @brief Appends one combatant's stats to every column.
+     * @param stats The stats to append.
+     * @return Index of the new combatant.
+     * @throws std::out_of_range if a value does not fit in T; nothing is appended in that case.
+     */
+    uint32_t push_back(const Stats& stats) {
+        T values[] = {
+            narrowStat<T>(stats.health, "health"), narrowStat<T>(stats.maxHealth, "maxHealth"),
+            narrowStat<T>(stats.attack, "attack"), narrowStat<T>(stats.defense, "defense"),
+            narrowStat<T>(stats.speed, "speed"), narrowStat<T>(stats.mana, "mana"),
+            narrowStat<T>(stats.maxMana, "maxMana")
+        };
+        health.push_back(values[0]);
+        maxHealth.push_back(values[1]);
+        attack.push_back(values[2]);
+        defense.push_back(values[3]);
+        speed.push_back(values[4]);
+        mana.push_back(values[5]);
+        maxMana.push_back(values[6]);
+        return static_cast<uint32_t>(health.size() - 1);
+    }
+
+    /**
+     * @brief Reassembles one combatant's stats from the columns.
+     * @param index Index returned by push_back().
+     */
+    Stats get(uint32_t index) const {
+        Stats stats;
+        stats.health = health[index];
+        stats.maxHealth = maxHealth[index];
+        stats.attack = attack[index];
+        stats.defense = defense[index];
+        stats.speed = speed[index];
+        stats.mana = mana[index];
+        stats.maxMana = maxMana[index];
+        return stats;
+    }
+
+    /**
+     * @brief Retrieves the number of combatants stored.
+     */
+    size_t size() const { return health.size(); }
+};
+
+using StatsColumns = BasicStatsColumns<int32_t>;        ///< Full-range stats columns
+using PackedStatsColumns = BasicStatsColumns<int16_t>;  ///< 16-bit stats columns: half the memory, twice the SIMD lanes
+
 /**
  * @brief Defines entity allegiance for team-based mechanics.
  * @details Used by AI systems, targeting logic, and victory condition checks.
@@ -81,8 +261,12 @@ enum class BattleState {
     DEFEAT          ///< Battle concluded with player failure
 };
 
+class World;
+
 /**
  * @brief Callback type for battle event subscriptions.
- * @details Used by the event system to notify subscribers of state changes and turn transitions.
+ * @details Used by the event system to notify subscribers of state changes and turn transitions. Subscribers
+ *          receive the battle's World and read battle-global state from its resources, so they can be free
+ *          functions instead of lambdas capturing a system.
  */
-using BattleEvent = std::function<void()>;
\ No newline at end of file
+using BattleEvent = std::function<void(World&)>;
\ No newline at end of file
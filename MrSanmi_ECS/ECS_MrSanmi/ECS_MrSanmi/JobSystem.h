@@ -0,0 +1,307 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: JobSystem.h
+ * @brief: Work-stealing job system shared by the ECS scheduler, views and battle simulation.
+ * @details: Every worker owns a deque of jobs. A worker pushes and pops its own jobs at the back (newest first,
+ *           so a job's continuations usually run on the thread that just touched the same data) and, when it
+ *           runs dry, steals the oldest job from the front of another worker's deque. Jobs may depend on other
+ *           jobs: a job only becomes runnable once all of its dependencies finished, which lets callers build
+ *           task graphs with continuations. Threads waiting for a job help by running other jobs meanwhile.
+ *           The JobSystem is stored as a World resource, so systems find it through the World.
+ */
+
+ /**
+  * @brief One unit of work and the jobs waiting for it.
+  * @details Created by JobSystem::schedule(); callers only hold it through a JobHandle.
+  */
+struct Job {
+    std::function<void()> work;                     ///< The work to run
+    std::atomic<uint32_t> waitingFor{ 1 };          ///< Unfinished dependencies, plus one until scheduled
+    std::atomic<bool> done{ false };                ///< Set once work has run and continuations were released
+    std::mutex mutex;                               ///< Guards continuations and finished
+    std::vector<std::shared_ptr<Job>> continuations; ///< Jobs depending on this one
+    bool finished{ false };                         ///< Whether continuations were already released
+};
+
+/**
+ * @brief Shared handle to a scheduled job, used to wait for it or to make other jobs depend on it.
+ */
+using JobHandle = std::shared_ptr<Job>;
+
+/**
+ * @brief Worker threads executing jobs from per-worker deques, stealing from each other when idle.
+ * @example
+ * @code
+ * JobSystem& jobs = *world.getResource<JobSystem>();
+ * JobHandle load = jobs.schedule([] { ... });
+ * JobHandle use = jobs.schedule([] { ... }, { load });   // continuation of load
+ * jobs.wait(use);
+ *
+ * jobs.parallelFor(0, items.size(), 1024, [&](size_t begin, size_t end) { ... });
+ * @endcode
+ */
+class JobSystem {
+private:
+    /**
+     * @brief Deque of runnable jobs owned by one worker.
+     */
+    struct WorkQueue {
+        std::mutex mutex;               ///< Guards jobs; held only for a push, pop or steal
+        std::deque<JobHandle> jobs;     ///< Owner works at the back, thieves take from the front
+    };
+
+    std::vector<std::thread> workers;                   ///< Worker threads, started by the constructor
+    std::vector<std::unique_ptr<WorkQueue>> queues;     ///< One deque per worker (one shared deque without workers)
+    std::atomic<size_t> queuedJobs{ 0 };                ///< Runnable jobs sitting in any deque
+    std::atomic<size_t> nextQueue{ 0 };                 ///< Round-robin target for jobs submitted from outside
+    std::mutex sleepMutex;                              ///< Pairs with wakeUp for idle workers
+    std::condition_variable wakeUp;                     ///< Signals idle workers that a job arrived or the system stops
+    bool stopping{ false };                             ///< Set by the destructor, guarded by sleepMutex
+
+    static inline thread_local const JobSystem* currentSystem = nullptr;   ///< System the calling thread works for
+    static inline thread_local size_t currentWorker = 0;                   ///< Index of the calling worker thread
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threadCount Number of workers. Defaults to one less than the hardware threads, leaving a core to
+     *                    the thread that schedules work and helps while waiting for it. With zero workers, jobs
+     *                    run inside wait() on the waiting thread.
+     */
+    explicit JobSystem(size_t threadCount = defaultThreadCount()) {
+        size_t queueCount = std::max<size_t>(threadCount, 1);
+        for (size_t i = 0; i < queueCount; ++i) {
+            queues.push_back(std::make_unique<WorkQueue>());
+        }
+
+        workers.reserve(threadCount);
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Finishes every runnable job, then joins the workers.
+     * @warning Jobs still waiting for dependencies that never finish are dropped.
+     */
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Schedules a job, to run once all of its dependencies have finished.
+     * @param work The work to run. It must not throw.
+     * @param dependencies Jobs that must finish first; the new job becomes their continuation.
+     * @return Handle to wait for the job or to make later jobs depend on it.
+     */
+    JobHandle schedule(std::function<void()> work, const std::vector<JobHandle>& dependencies = {}) {
+        auto job = std::make_shared<Job>();
+        job->work = std::move(work);
+        job->waitingFor.store(static_cast<uint32_t>(dependencies.size()) + 1, std::memory_order_relaxed);
+
+        for (const JobHandle& dependency : dependencies) {
+            std::lock_guard<std::mutex> lock(dependency->mutex);
+            if (!dependency->finished) {
+                dependency->continuations.push_back(job);
+            }
+            else {
+                job->waitingFor.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        release(job);
+        return job;
+    }
+
+    /**
+     * @brief Blocks until a job has finished, running other jobs in the meantime.
+     * @param job The job to wait for.
+     */
+    void wait(const JobHandle& job) {
+        while (!job->done.load(std::memory_order_acquire)) {
+            if (JobHandle other = findJob(callerQueue())) {
+                execute(other);
+            }
+            else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /**
+     * @brief Runs a function over an index range split into chunks, in parallel, and waits for all of them.
+     * @tparam Func Callable with signature void(size_t begin, size_t end).
+     * @param begin First index of the range.
+     * @param end One past the last index of the range.
+     * @param grain Maximum number of indices per chunk.
+     * @param fn The callback receiving each chunk's index range.
+     * @details Chunk boundaries depend only on begin, end and grain, never on the number of workers.
+     */
+    template<typename Func>
+    void parallelFor(size_t begin, size_t end, size_t grain, Func&& fn) {
+        if (begin >= end) return;
+        grain = std::max<size_t>(grain, 1);
+
+        size_t chunks = (end - begin + grain - 1) / grain;
+        if (chunks == 1 || workers.empty()) {
+            for (size_t first = begin; first < end; first += grain) {
+                fn(first, std::min(first + grain, end));
+            }
+            return;
+        }
+
+        std::vector<JobHandle> jobs;
+        jobs.reserve(chunks);
+        for (size_t first = begin; first < end; first += grain) {
+            size_t last = std::min(first + grain, end);
+            jobs.push_back(schedule([&fn, first, last] { fn(first, last); }));
+        }
+        for (const JobHandle& job : jobs) {
+            wait(job);
+        }
+    }
+
+    /**
+     * @brief Retrieves the number of worker threads.
+     */
+    size_t size() const { return workers.size(); }
+
+    /**
+     * @brief Computes the default worker count: hardware threads minus one, at least one.
+     */
+    static size_t defaultThreadCount() {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 1;
+    }
+
+private:
+    /**
+     * @brief Drops the scheduling hold on a job, queueing it if no dependency is left.
+     */
+    void release(const JobHandle& job) {
+        if (job->waitingFor.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            push(job);
+        }
+    }
+
+    /**
+     * @brief Queues a runnable job: on the calling worker's own deque, or round-robin from other threads.
+     */
+    void push(JobHandle job) {
+        size_t target = callerQueue();
+        if (target == queues.size()) {
+            target = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queues[target]->mutex);
+            queues[target]->jobs.push_back(std::move(job));
+        }
+        queuedJobs.fetch_add(1, std::memory_order_release);
+
+        // Taking the lock orders this push against a worker checking queuedJobs before sleeping
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wakeUp.notify_one();
+    }
+
+    /**
+     * @brief Takes a runnable job: the newest from the caller's own deque, else the oldest from another.
+     * @param own Index of the caller's deque, or queues.size() for threads that own none.
+     * @return The job, or nullptr if every deque is empty.
+     */
+    JobHandle findJob(size_t own) {
+        if (queuedJobs.load(std::memory_order_acquire) == 0) return nullptr;
+
+        if (own < queues.size()) {
+            WorkQueue& queue = *queues[own];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                JobHandle job = std::move(queue.jobs.back());
+                queue.jobs.pop_back();
+                queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        size_t start = own < queues.size() ? own + 1 : 0;
+        for (size_t i = 0; i < queues.size(); ++i) {
+            WorkQueue& victim = *queues[(start + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty()) {
+                JobHandle job = std::move(victim.jobs.front());
+                victim.jobs.pop_front();
+                queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Runs a job, marks it done and releases its continuations.
+     */
+    void execute(const JobHandle& job) {
+        if (job->work) job->work();
+
+        std::vector<JobHandle> continuations;
+        {
+            std::lock_guard<std::mutex> lock(job->mutex);
+            job->finished = true;
+            continuations.swap(job->continuations);
+        }
+        job->done.store(true, std::memory_order_release);
+
+        for (const JobHandle& continuation : continuations) {
+            release(continuation);
+        }
+    }
+
+    /**
+     * @brief Retrieves the deque owned by the calling thread.
+     * @return The worker index, or queues.size() if the caller is not one of this system's workers.
+     */
+    size_t callerQueue() const {
+        return currentSystem == this ? currentWorker : queues.size();
+    }
+
+    /**
+     * @brief Runs and steals jobs until the system stops and no runnable job is left.
+     */
+    void workerLoop(size_t index) {
+        currentSystem = this;
+        currentWorker = index;
+
+        for (;;) {
+            if (JobHandle job = findJob(index)) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this] { return stopping || queuedJobs.load(std::memory_order_acquire) > 0; });
+            if (stopping && queuedJobs.load(std::memory_order_acquire) == 0) return;
+        }
+    }
+};
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <cstdlib>
+#include <sstream>
 
 /**
  * @Author: Miguel Angel Garcia Elizalde
@@ -20,8 +21,18 @@
   */
 class Game {
 private:
-    BattleManager battleManager;    ///< Core battle system controller
-    bool gameRunning{ true };       ///< Flag indicating if the game should continue running
+    /**
+     * @brief Console text last generated for one entity.
+     */
+    struct EntityPanel {
+        EntityId id;        ///< Entity the text was generated for
+        std::string text;   ///< Formatted status lines
+    };
+
+    BattleManager battleManager;     ///< Core battle system controller
+    bool gameRunning{ true };        ///< Flag indicating if the game should continue running
+    std::vector<EntityPanel> panels; ///< Cached entity panels, by EntityIndex
+    Tick lastRenderTick{ 0 };        ///< Change tick closed by the previous render
 
 public:
     /**
@@ -84,6 +95,7 @@ private:
 
         displayBattlefield();
         displayCurrentTurnInfo();
+        lastRenderTick = battleManager.advanceChangeTick();
 
         if (battleManager.getBattleState() == BattleState::PLAYER_CHOICE) {
             displayActionMenu();
@@ -146,28 +158,47 @@ private:
 
     /**
      * @brief Displays detailed information for a single entity.
-     * @param entity The entity to display information for.
+     * @param id The generational ID of the entity to display information for.
      * @param index The positional index of the entity (for potential UI formatting).
      * @param isPlayer Flag indicating if the entity belongs to the player team.
      */
-    void displayEntityInfo(const Ref<Entity>& entity, size_t index, bool isPlayer) {
-        auto* transform = entity->getComponent<TransformComponent>();
-        auto* health = entity->getComponent<HealthComponent>();
+    void displayEntityInfo(EntityId id, size_t index, bool isPlayer) {
+        Entity entity = battleManager.getEntity(id);
+        auto* display = entity.readComponent<DisplayInfo>();
+        auto* state = entity.readComponent<CombatState>();
+        auto* base = entity.readComponent<CombatBaseStats>();
 
-        if (!transform || !health) return;
+        if (!display || !state || !base) return;
 
-        std::string teamIcon = isPlayer ? "[ALLY]" : "[ENEMY]";
-        std::string healthBar = generateHealthBar(health->stats.health, health->stats.maxHealth);
-        std::string status = health->isAlive ? "ALIVE" : "DEAD";
+        if (id.index >= panels.size()) {
+            panels.resize(id.index + 1);
+        }
 
-        std::cout << status << " " << teamIcon << " " << transform->name << "\n";
-        std::cout << "   HP: " << healthBar << " " << health->stats.health << "/" << health->stats.maxHealth << "\n";
-        std::cout << "   Mana: " << health->stats.mana << "/" << health->stats.maxMana;
+        // Only entities whose components changed since the last render are formatted again
+        EntityPanel& panel = panels[id.index];
+        if (panel.id != id ||
+            entity.isChanged<CombatState>(lastRenderTick) ||
+            entity.isChanged<CombatBaseStats>(lastRenderTick) ||
+            entity.isChanged<DisplayInfo>(lastRenderTick)) {
+            std::string teamIcon = isPlayer ? "[ALLY]" : "[ENEMY]";
+            std::string healthBar = generateHealthBar(state->health, base->maxHealth);
+            std::string status = entity.hasComponent<Alive>() ? "ALIVE" : "DEAD";
+
+            std::ostringstream text;
+            text << status << " " << teamIcon << " " << display->name << "\n";
+            text << "   HP: " << healthBar << " " << state->health << "/" << base->maxHealth << "\n";
+            text << "   Mana: " << state->mana << "/" << base->maxMana;
+
+            if (isPlayer) {
+                text << " | ATK: " << base->attack << " | DEF: " << base->defense;
+            }
+            text << "\n\n";
 
-        if (isPlayer) {
-            std::cout << " | ATK: " << health->stats.attack << " | DEF: " << health->stats.defense;
+            panel.id = id;
+            panel.text = text.str();
         }
-        std::cout << "\n\n";
+
+        std::cout << panel.text;
     }
 
     /**
@@ -199,14 +230,14 @@ private:
      * @brief Displays information about the current turn and active entity.
      */
     void displayCurrentTurnInfo() {
-        auto currentActor = battleManager.getCurrentActor();
-        if (!currentActor) return;
+        Entity currentActor = battleManager.getEntity(battleManager.getCurrentActor());
+        if (!currentActor.isValid()) return;
 
-        auto* transform = currentActor->getComponent<TransformComponent>();
-        auto* health = currentActor->getComponent<HealthComponent>();
+        auto* display = currentActor.readComponent<DisplayInfo>();
+        auto* state = currentActor.readComponent<CombatState>();
 
-        if (transform && health && health->isAlive) {
-            std::cout << ">>> CURRENT TURN: " << transform->name;
+        if (display && state && currentActor.hasComponent<Alive>()) {
+            std::cout << ">>> CURRENT TURN: " << display->name;
             std::cout << " | State: ";
 
             switch (battleManager.getBattleState()) {
@@ -225,8 +256,7 @@ private:
      * @brief Displays the available action menu for player input.
      */
     void displayActionMenu() {
-        auto currentActor = battleManager.getCurrentActor();
-        if (!currentActor) return;
+        if (battleManager.getCurrentActor().isNull()) return;
 
         std::cout << "=== AVAILABLE ACTIONS ===\n";
 
@@ -303,38 +333,42 @@ private:
         auto enemies = battleManager.getEnemies();
         auto players = battleManager.getPlayers();
 
-        Ref<Entity> target = nullptr;
+        EntityId target;
+        const CombatState* targetHealth = nullptr;
 
         if (skillName == "heal") {
             // For healing, select ally with lowest health
-            for (auto& player : players) {
-                if (player->getComponent<HealthComponent>()->isAlive) {
-                    if (!target || player->getComponent<HealthComponent>()->stats.health <
-                        target->getComponent<HealthComponent>()->stats.health) {
+            for (EntityId player : players) {
+                auto* playerHealth = battleManager.getEntity(player).readComponent<CombatState>();
+                if (battleManager.getEntity(player).hasComponent<Alive>()) {
+                    if (!targetHealth || playerHealth->health < targetHealth->health) {
                         target = player;
+                        targetHealth = playerHealth;
                     }
                 }
             }
         }
         else {
             // For attacks, select first alive enemy
-            for (auto& enemy : enemies) {
-                if (enemy->getComponent<HealthComponent>()->isAlive) {
+            for (EntityId enemy : enemies) {
+                auto* enemyHealth = battleManager.getEntity(enemy).readComponent<CombatState>();
+                if (battleManager.getEntity(enemy).hasComponent<Alive>()) {
                     target = enemy;
+                    targetHealth = enemyHealth;
                     break;
                 }
             }
         }
 
-        if (target) {
+        if (targetHealth) {
             battleManager.executePlayerAction(skillName, target);
 
             // Show action feedback
-            auto* actorTransform = battleManager.getCurrentActor()->getComponent<TransformComponent>();
-            auto* targetTransform = target->getComponent<TransformComponent>();
+            auto* actorDisplay = battleManager.getEntity(battleManager.getCurrentActor()).readComponent<DisplayInfo>();
+            auto* targetDisplay = battleManager.getEntity(target).readComponent<DisplayInfo>();
 
-            std::cout << "\n " << actorTransform->name << " uses " << skillName
-                << " on " << targetTransform->name << "!\n";
+            std::cout << "\n " << actorDisplay->name << " uses " << skillName
+                << " on " << targetDisplay->name << "!\n";
             std::this_thread::sleep_for(std::chrono::seconds(2));
         }
     }
@@ -347,19 +381,21 @@ private:
         std::cout << "=== DETAILED STATUS ===\n\n";
 
         auto entities = battleManager.getEntities();
-        for (const auto& entity : entities) {
-            auto* transform = entity->getComponent<TransformComponent>();
-            auto* health = entity->getComponent<HealthComponent>();
-
-            if (transform && health) {
-                std::string team = (transform->team == Team::PLAYER) ? "Ally" : "Enemy";
-                std::string status = health->isAlive ? "Alive" : "Defeated";
-
-                std::cout << "[" << team << "] " << transform->name << " - " << status << "\n";
-                std::cout << "   Health: " << health->stats.health << "/" << health->stats.maxHealth << "\n";
-                std::cout << "   Mana: " << health->stats.mana << "/" << health->stats.maxMana << "\n";
-                std::cout << "   Attack: " << health->stats.attack << " | Defense: " << health->stats.defense;
-                std::cout << " | Speed: " << health->stats.speed << "\n\n";
+        for (EntityId id : entities) {
+            Entity entity = battleManager.getEntity(id);
+            auto* display = entity.readComponent<DisplayInfo>();
+            auto* state = entity.readComponent<CombatState>();
+            auto* base = entity.readComponent<CombatBaseStats>();
+
+            if (display && state && base) {
+                std::string team = entity.hasComponent<PlayerTeam>() ? "Ally" : "Enemy";
+                std::string status = entity.hasComponent<Alive>() ? "Alive" : "Defeated";
+
+                std::cout << "[" << team << "] " << display->name << " - " << status << "\n";
+                std::cout << "   Health: " << state->health << "/" << base->maxHealth << "\n";
+                std::cout << "   Mana: " << state->mana << "/" << base->maxMana << "\n";
+                std::cout << "   Attack: " << base->attack << " | Defense: " << base->defense;
+                std::cout << " | Speed: " << base->speed << "\n\n";
             }
         }
 
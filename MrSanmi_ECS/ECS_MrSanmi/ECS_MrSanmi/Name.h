@@ -0,0 +1,128 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Name.h
+ * @brief: Interned names: 4-byte NameId handles to strings stored once per process.
+ * @details: Entity names repeat a lot (a wave of 500 "Goblin"s), and they are only read to print log lines.
+ *           NameTable keeps one copy of every distinct string; components store the NameId instead, so they
+ *           stay trivially copyable and spawning, relocating or snapshotting them never touches string data.
+ *           Like Unreal's FName, the table is process-wide and never shrinks: names are few and reused across
+ *           battles. Interning and lookups are thread-safe.
+ */
+
+class NameId;
+
+/**
+ * @brief Process-wide table of interned strings, indexed by NameId.
+ */
+class NameTable {
+private:
+    mutable std::shared_mutex mutex;                        ///< Guards names and indices
+    std::deque<std::string> names;                          ///< Interned strings; a deque keeps them in place
+    std::unordered_map<std::string_view, uint32_t> indices; ///< Index of each string, keyed by views into names
+
+    NameTable() { names.emplace_back(); }
+
+public:
+    NameTable(const NameTable&) = delete;
+    NameTable& operator=(const NameTable&) = delete;
+
+    /**
+     * @brief Retrieves the process-wide table.
+     */
+    static NameTable& instance() {
+        static NameTable table;
+        return table;
+    }
+
+    /**
+     * @brief Finds the index of a string, adding it to the table if it is new.
+     * @param text The string to intern.
+     * @return Index of the string; 0 for the empty string.
+     */
+    uint32_t intern(std::string_view text) {
+        if (text.empty()) return 0;
+
+        {
+            std::shared_lock lock(mutex);
+            auto it = indices.find(text);
+            if (it != indices.end()) return it->second;
+        }
+
+        std::unique_lock lock(mutex);
+        auto it = indices.find(text);
+        if (it != indices.end()) return it->second;
+
+        uint32_t index = static_cast<uint32_t>(names.size());
+        const std::string& stored = names.emplace_back(text);
+        indices.emplace(stored, index);
+        return index;
+    }
+
+    /**
+     * @brief Retrieves an interned string.
+     * @param index Index returned by intern().
+     * @return The string; it stays valid for the rest of the program.
+     */
+    const std::string& lookup(uint32_t index) const {
+        std::shared_lock lock(mutex);
+        return names[index];
+    }
+
+    /**
+     * @brief Retrieves the number of distinct strings interned, including the empty string.
+     */
+    size_t size() const {
+        std::shared_lock lock(mutex);
+        return names.size();
+    }
+};
+
+/**
+ * @brief 4-byte handle to an interned string.
+ * @details Equal strings always get equal IDs, so names compare and hash as integers. The default NameId
+ *          is the empty string.
+ */
+class NameId {
+private:
+    uint32_t index{ 0 };    ///< Index in NameTable
+
+public:
+    NameId() = default;
+
+    /**
+     * @brief Interns a string.
+     * @param text The string to intern.
+     */
+    explicit NameId(std::string_view text) : index(NameTable::instance().intern(text)) {}
+
+    /**
+     * @brief Retrieves the interned string.
+     */
+    const std::string& str() const { return NameTable::instance().lookup(index); }
+
+    /**
+     * @brief Retrieves the index of the string in NameTable.
+     */
+    uint32_t getIndex() const { return index; }
+
+    bool operator==(const NameId& other) const { return index == other.index; }
+    bool operator!=(const NameId& other) const { return index != other.index; }
+};
+
+/**
+ * @brief Writes the interned string; the only place name text is read.
+ */
+inline std::ostream& operator<<(std::ostream& out, NameId name) {
+    return out << name.str();
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#pragma once
+#include "GameTypes.h"
+#include "Component.h"
+#include <vector>
+#include <utility>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Observer.h
+ * @brief: Batched notifications of component additions, removals and changes.
+ * @details: An Observer is registered with the World for one component type and a set of events. The World
+ *           appends the affected entity to the observer's pending list as the event happens; nothing is
+ *           called back at that point. A system drains the list once per pass, so its work is proportional
+ *           to what actually changed instead of to the number of entities.
+ */
+
+ /**
+  * @brief Kinds of component events an Observer can listen to. Values are bit flags and can be combined.
+  */
+enum class ComponentEvent : uint8_t {
+    Added = 1 << 0,     ///< The entity gained the component (adding an existing one counts as Changed)
+    Removed = 1 << 1,   ///< The entity lost the component, including when the entity was destroyed
+    Changed = 1 << 2    ///< The component was accessed mutably or overwritten
+};
+
+constexpr ComponentEvent operator|(ComponentEvent a, ComponentEvent b) {
+    return static_cast<ComponentEvent>(static_cast<uint8_t>(a) | static_cast<uint8_t>(b));
+}
+
+/**
+ * @brief Checks if an event set includes a given event.
+ * @param events The combined flags to test.
+ * @param event The single event looked for.
+ * @return True if event is one of events.
+ */
+constexpr bool hasEvent(ComponentEvent events, ComponentEvent event) {
+    return (static_cast<uint8_t>(events) & static_cast<uint8_t>(event)) != 0;
+}
+
+/**
+ * @brief Pending list of entities for which observed component events happened since the last drain.
+ * @details Each handle is listed at most once per batch, however many events it received. Handles are compared
+ *          with their generation, so if a slot is destroyed and reused before the drain, both the old and the
+ *          new entity are listed and the old one's Removed event is not lost. Created and owned by
+ *          World::observe(), so references to it stay valid for the World's lifetime.
+ */
+class Observer {
+private:
+    ComponentId type;                   ///< Observed component type
+    ComponentEvent events;              ///< Observed events
+    std::vector<EntityId> pending;      ///< Entities notified since the last drain
+    std::vector<EntityId> draining;     ///< Batch being handed out by drain(), kept to reuse its capacity
+    std::vector<uint32_t> queuedAt;     ///< Entity index to its newest handle's position plus one (0 if not queued)
+
+public:
+    /**
+     * @brief Constructs an observer with an empty batch.
+     * @param observedType ComponentId of the observed component type.
+     * @param observedEvents Events that queue an entity.
+     */
+    Observer(ComponentId observedType, ComponentEvent observedEvents)
+        : type(observedType), events(observedEvents) {
+    }
+
+    /**
+     * @brief Retrieves the observed component type.
+     */
+    ComponentId getType() const { return type; }
+
+    /**
+     * @brief Retrieves the observed events.
+     */
+    ComponentEvent getEvents() const { return events; }
+
+    /**
+     * @brief Queues an entity for the next drain.
+     * @param entity The entity the event happened to.
+     * @details Does nothing if this handle is already queued. A newer generation of a queued slot is queued
+     *          next to the older one instead of replacing it.
+     */
+    void push(EntityId entity) {
+        if (entity.index >= queuedAt.size()) {
+            queuedAt.resize(entity.index + 1, 0);
+        }
+
+        // Only the newest generation of a slot can receive further events, so it is the one compared
+        uint32_t& slot = queuedAt[entity.index];
+        if (slot && pending[slot - 1] == entity) {
+            return;
+        }
+        pending.push_back(entity);
+        slot = static_cast<uint32_t>(pending.size());
+    }
+
+    /**
+     * @brief Hands every queued entity to a callback and starts a new batch.
+     * @tparam Func Callable with signature void(EntityId).
+     * @param fn The callback receiving each queued entity.
+     * @details Events raised while draining (e.g. by the callback itself) are queued for the next drain.
+     * @warning Queued handles may have been destroyed since; check World::isAlive before using them.
+     */
+    template<typename Func>
+    void drain(Func&& fn) {
+        draining.swap(pending);
+        for (EntityId entity : draining) {
+            queuedAt[entity.index] = 0;
+        }
+        for (EntityId entity : draining) {
+            fn(entity);
+        }
+        draining.clear();
+    }
+
+    /**
+     * @brief Drops every queued entity without processing it.
+     */
+    void clear() {
+        for (EntityId entity : pending) {
+            queuedAt[entity.index] = 0;
+        }
+        pending.clear();
+    }
+
+    /**
+     * @brief Checks if no entity is queued.
+     */
+    bool empty() const { return pending.empty(); }
+
+    /**
+     * @brief Retrieves the number of queued entities.
+     */
+    size_t size() const { return pending.size(); }
+};
\ No newline at end of file
@@ -0,0 +1,209 @@
+#pragma once
+#include "World.h"
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Prefab.h
+ * @brief: Entity templates for spawning many entities with the same component layout at once.
+ * @details: A Prefab stores one value per component type. World::spawnBatch resolves the target archetype
+ *           once, reserves all storage once and fills each column in bulk, so spawning a wave of identical
+ *           enemies costs one archetype lookup and a handful of allocations instead of several per entity.
+ */
+
+ /**
+  * @brief Type-erased prefab entry holding the initial value of one component type.
+  */
+struct IPrefabComponent {
+    virtual ~IPrefabComponent() = default;
+
+    /**
+     * @brief Retrieves the ComponentId of the stored value.
+     * @return The component type's ID.
+     */
+    virtual ComponentId getId() const = 0;
+
+    /**
+     * @brief Checks if the component type lives in a sparse-set pool rather than in the archetype.
+     * @return True for StorageType::SparseSet components.
+     */
+    virtual bool isSparse() const = 0;
+
+    /**
+     * @brief Makes sure the world can store count more components of this type.
+     * @param world The world about to receive the entities.
+     * @param count Number of entities being spawned.
+     */
+    virtual void prepare(World& world, size_t count) const = 0;
+
+    /**
+     * @brief Writes the prefab value for every newly spawned entity.
+     * @param world The world receiving the entities.
+     * @param archetype The archetype the new rows were appended to.
+     * @param firstRow Row of the first new entity; the rows of the batch are contiguous.
+     * @param entities Handles of the new entities, in row order.
+     * @param count Number of new entities.
+     */
+    virtual void fill(World& world, Archetype& archetype, size_t firstRow, const EntityId* entities, size_t count) const = 0;
+
+    /**
+     * @brief Adds a copy of the prefab value to an existing entity.
+     * @param world The world owning the entity.
+     * @param entity The entity receiving the component.
+     */
+    virtual void addTo(World& world, EntityId entity) const = 0;
+};
+
+/**
+ * @brief Prefab entry for component type T.
+ * @tparam T The component type.
+ */
+template<typename T>
+struct PrefabComponent : IPrefabComponent {
+    T value;    ///< Value copied into every spawned entity
+
+    template<typename... Args>
+    explicit PrefabComponent(Args&&... args) : value(std::forward<Args>(args)...) {}
+
+    ComponentId getId() const override { return componentId<T>; }
+
+    bool isSparse() const override {
+        return ComponentStorage<T>::type == StorageType::SparseSet;
+    }
+
+    void prepare(World& world, size_t count) const override {
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            auto& pool = world.getPool<T>();
+            pool.reserve(pool.size() + count);
+        }
+        else if constexpr (ComponentStorage<T>::type == StorageType::Table) {
+            world.registerColumn<T>();
+        }
+    }
+
+    void fill(World& world, Archetype& archetype, size_t firstRow, const EntityId* entities, size_t count) const override {
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            auto& pool = world.getPool<T>();
+            for (size_t i = 0; i < count; ++i) {
+                pool.emplace(entities[i], value);
+                pool.markChanged(entities[i].index, world.getChangeTick());
+            }
+        }
+        else if constexpr (ComponentStorage<T>::type == StorageType::Table) {
+            // One bulk fill per chunk; for trivially copyable components this lowers to plain memory copies
+            archetype.fill<T>(firstRow, count, value, world.getChangeTick());
+        }
+    }
+
+    void addTo(World& world, EntityId entity) const override {
+        world.addComponent<T>(entity, value);
+    }
+};
+
+/**
+ * @brief Template describing the components, and their initial values, of a kind of entity.
+ * @example
+ * @code
+ * Prefab goblin;
+ * Stats goblinStats(10, 14, 4, 10, 20);
+ * goblin.add<DisplayInfo>("Goblin")
+ *       .add<CombatState>(goblinStats)
+ *       .add<CombatBaseStats>(goblinStats)
+ *       .add<EnemyTeam>()
+ *       .add<Alive>();
+ * std::vector<EntityId> wave = world.spawnBatch(goblin, 500);
+ * @endcode
+ */
+class Prefab {
+private:
+    ComponentMask mask;                                 ///< Every component type in the prefab
+    std::vector<Scope<IPrefabComponent>> components;    ///< Initial value of each component type
+
+public:
+    /**
+     * @brief Sets the initial value of a component type.
+     * @tparam T The component type.
+     * @tparam Args Constructor argument types.
+     * @param args Forwarded arguments to the component's constructor.
+     * @return This prefab, for chaining.
+     * @note Replaces the previous value if T was already added.
+     */
+    template<typename T, typename... Args>
+    Prefab& add(Args&&... args) {
+        auto component = std::make_unique<PrefabComponent<T>>(std::forward<Args>(args)...);
+        for (auto& existing : components) {
+            if (existing->getId() == componentId<T>) {
+                existing = std::move(component);
+                return *this;
+            }
+        }
+
+        mask.set(componentId<T>);
+        components.push_back(std::move(component));
+        return *this;
+    }
+
+    /**
+     * @brief Retrieves the signature of every component in the prefab.
+     * @return The prefab's component mask.
+     */
+    const ComponentMask& getMask() const { return mask; }
+
+    /**
+     * @brief Provides the stored component values.
+     * @return Constant reference to the prefab entries.
+     */
+    const std::vector<Scope<IPrefabComponent>>& getComponents() const { return components; }
+
+    /**
+     * @brief Gives an existing entity a copy of every prefab component.
+     * @param world The world owning the entity.
+     * @param entity The entity to populate, typically a recycled one from an EntityPool.
+     */
+    void instantiate(World& world, EntityId entity) const {
+        for (const auto& component : components) {
+            component->addTo(world, entity);
+        }
+    }
+};
+
+inline std::vector<EntityId> World::spawnBatch(const Prefab& prefab, size_t count) {
+    std::vector<EntityId> spawned;
+    spawned.reserve(count);
+
+    ComponentMask tableMask;
+    for (const auto& component : prefab.getComponents()) {
+        component->prepare(*this, count);
+        if (!component->isSparse()) {
+            tableMask.set(component->getId());
+        }
+    }
+
+    Archetype* archetype = getOrCreateArchetype(tableMask);
+    size_t firstRow = archetype->size();
+    archetype->reserve(firstRow + count);
+    if (count > freeIndices.size()) {
+        records.reserve(records.size() + count - freeIndices.size());
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        EntityIndex index = allocateIndex();
+        EntityRecord& record = records[index];
+        EntityId id{ index, record.generation };
+        record.archetype = archetype;
+        record.row = archetype->appendRow(id);
+        record.mask = prefab.getMask();
+        spawned.push_back(id);
+    }
+
+    for (const auto& component : prefab.getComponents()) {
+        component->fill(*this, *archetype, firstRow, spawned.data(), count);
+        if (isObserved(component->getId(), ComponentEvent::Added)) {
+            for (EntityId id : spawned) {
+                notify(component->getId(), ComponentEvent::Added, id);
+            }
+        }
+    }
+    return spawned;
+}
\ No newline at end of file
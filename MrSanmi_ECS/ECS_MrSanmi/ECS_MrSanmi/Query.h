@@ -0,0 +1,116 @@
+#pragma once
+#include "View.h"
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Query.h
+ * @brief: Persistent queries that cache their matching archetypes.
+ * @details: A View tests every archetype of the world each time it is iterated. A Query is kept by the system
+ *           that runs it and remembers which archetypes matched. Archetypes are only ever appended to the World,
+ *           so each call tests just the archetypes created since the previous one; World::reset() is detected
+ *           through the archetype generation and rebuilds the cache. Repeated iteration then costs O(matches)
+ *           and allocates nothing once the cache is warm.
+ */
+
+ /**
+  * @brief Persistent query over every entity that owns all component types Ts.
+  * @tparam Ts Component types to match, as for View.
+  * @details Holds the same filters as a View plus the cache of matching archetypes. Set the filters once, right
+  *          after creation; changing them drops the cache.
+  * @example
+  * @code
+  * Query<const CombatState> enemies = world.query<const CombatState>();
+  * enemies.with<EnemyTeam, Alive>();
+  * enemies.each([](EntityId enemy, const CombatState& state) { ... });
+  * @endcode
+  */
+template<typename... Ts>
+class Query {
+private:
+    View<Ts...> view;       ///< Filters and iteration
+    QueryCache cache;       ///< Archetypes matching the filters
+
+public:
+    /**
+     * @brief Constructs a query over the given world.
+     * @param queried The world whose entities are matched.
+     */
+    explicit Query(World& queried) : view(queried) {}
+
+    /**
+     * @brief Restricts the query to entities that also own every component in Us.
+     * @return Reference to this query for chaining.
+     */
+    template<typename... Us>
+    Query& with() {
+        view.template with<Us...>();
+        cache = QueryCache{};
+        return *this;
+    }
+
+    /**
+     * @brief Restricts the query to entities owning none of the components in Us.
+     * @return Reference to this query for chaining.
+     */
+    template<typename... Us>
+    Query& without() {
+        view.template without<Us...>();
+        cache = QueryCache{};
+        return *this;
+    }
+
+    /**
+     * @brief Invokes a callback for every matching entity. See View::each().
+     */
+    template<typename Func>
+    void each(Func&& fn) {
+        bind().each(std::forward<Func>(fn));
+    }
+
+    /**
+     * @brief Invokes a callback for matching entities whose component C changed after a tick. See View::eachChanged().
+     */
+    template<typename C, typename Func>
+    void eachChanged(Tick since, Func&& fn) {
+        bind().template eachChanged<C>(since, std::forward<Func>(fn));
+    }
+
+    /**
+     * @brief Invokes a callback for every matching entity on the World's JobSystem. See View::parEach().
+     */
+    template<typename Func>
+    void parEach(Func&& fn, ParallelMode mode = ParallelMode::Deterministic) {
+        bind().parEach(std::forward<Func>(fn), mode);
+    }
+
+    /**
+     * @brief Folds every matching entity into a value on the World's JobSystem. See View::parReduce().
+     */
+    template<typename T, typename Func, typename Combine>
+    T parReduce(T identity, Func&& fn, Combine&& combine, ParallelMode mode = ParallelMode::Deterministic) {
+        return bind().parReduce(std::move(identity), std::forward<Func>(fn), std::forward<Combine>(combine), mode);
+    }
+
+    /**
+     * @brief Checks if no entity matches the query. See View::empty().
+     */
+    bool empty() {
+        return bind().empty();
+    }
+
+private:
+    /**
+     * @brief Points the view at this query's cache.
+     * @details Done per call rather than once, so copies of a query never share or dangle on a cache.
+     */
+    View<Ts...>& bind() {
+        view.cache = &cache;
+        return view;
+    }
+};
+
+template<typename... Ts>
+Query<Ts...> World::query() {
+    return Query<Ts...>(*this);
+}
\ No newline at end of file
@@ -0,0 +1,213 @@
+#pragma once
+#include "World.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Scheduler.h
+ * @brief: Runs registered systems concurrently when their declared data access does not conflict.
+ * @details: Every system declares the components and resources it reads and writes. Before running, the
+ *           Scheduler orders the systems into a dependency graph: a system waits for an earlier-registered
+ *           one only if one of them writes something the other reads or writes. Independent systems are
+ *           then handed to the World's JobSystem resource together, while conflicting ones keep their
+ *           registration order. Without a JobSystem the systems simply run in registration order.
+ *
+ *           Systems that run concurrently must not make structural changes (create/destroy entities,
+ *           add/remove components) or touch data they did not declare. Work that needs that goes into an
+ *           exclusive system, which never overlaps any other system.
+ */
+
+ /**
+  * @brief A unit of per-pass logic together with the data it accesses.
+  */
+struct System {
+    std::string name;                           ///< Name used in diagnostics
+    std::function<void(World&)> run;            ///< The system's logic
+    ComponentMask componentReads;               ///< Components read
+    ComponentMask componentWrites;              ///< Components written
+    std::vector<ResourceId> resourceReads;      ///< Resources read
+    std::vector<ResourceId> resourceWrites;     ///< Resources written
+    bool exclusive{ false };                    ///< Conflicts with every other system
+
+    /**
+     * @brief Declares read-only access to components and/or resources.
+     * @tparam Ts Registered component types or resource types.
+     * @return Reference to this system for chaining.
+     */
+    template<typename... Ts>
+    System& reads() {
+        (declare<Ts>(componentReads, resourceReads), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Declares write access to components and/or resources.
+     * @tparam Ts Registered component types or resource types.
+     * @return Reference to this system for chaining.
+     */
+    template<typename... Ts>
+    System& writes() {
+        (declare<Ts>(componentWrites, resourceWrites), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Checks if two systems may not run at the same time.
+     * @param other The system to compare with.
+     * @return True if either is exclusive or one writes data the other reads or writes.
+     */
+    bool conflictsWith(const System& other) const {
+        if (exclusive || other.exclusive) return true;
+
+        return componentWrites.intersects(other.componentReads) ||
+               componentWrites.intersects(other.componentWrites) ||
+               other.componentWrites.intersects(componentReads) ||
+               overlaps(resourceWrites, other.resourceReads) ||
+               overlaps(resourceWrites, other.resourceWrites) ||
+               overlaps(other.resourceWrites, resourceReads);
+    }
+
+private:
+    /**
+     * @brief Records one accessed type as a component bit or a resource ID.
+     */
+    template<typename T>
+    static void declare(ComponentMask& components, std::vector<ResourceId>& resources) {
+        using Stored = std::remove_const_t<T>;
+        if constexpr (indexOfComponent<Stored>(RegisteredComponents{}) < MaxComponents) {
+            components.set(componentId<Stored>);
+        }
+        else {
+            resources.push_back(resourceId<Stored>);
+        }
+    }
+
+    /**
+     * @brief Checks if two resource ID lists share an element.
+     */
+    static bool overlaps(const std::vector<ResourceId>& a, const std::vector<ResourceId>& b) {
+        for (ResourceId id : a) {
+            if (std::find(b.begin(), b.end(), id) != b.end()) return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Ordered set of systems run together once per pass (per turn, per frame...).
+ * @example
+ * @code
+ * scheduler.addSystem("mana regeneration", regenerateMana).writes<CombatState>().reads<CombatBaseStats, TurnCounter>();
+ * scheduler.addSystem("ai scoring", scoreTargets).reads<CombatState, PlayerTeam>();
+ * scheduler.run(world);
+ * @endcode
+ */
+class Scheduler {
+private:
+    std::vector<System> systems;                        ///< Registered systems, in registration order
+    std::vector<std::vector<size_t>> dependencies;      ///< Earlier systems each system must wait for
+    bool graphDirty{ true };                            ///< Set when systems changed since the graph was built
+
+public:
+    /**
+     * @brief Registers a system. Declare its data access on the returned reference.
+     * @param name Name used in diagnostics.
+     * @param run The system's logic.
+     * @return Reference to the new system, valid until the next system is added.
+     */
+    System& addSystem(std::string name, std::function<void(World&)> run) {
+        graphDirty = true;
+        System system;
+        system.name = std::move(name);
+        system.run = std::move(run);
+        systems.push_back(std::move(system));
+        return systems.back();
+    }
+
+    /**
+     * @brief Registers a system that never overlaps any other, e.g. one making structural changes or I/O.
+     * @param name Name used in diagnostics.
+     * @param run The system's logic.
+     * @return Reference to the new system, valid until the next system is added.
+     */
+    System& addExclusiveSystem(std::string name, std::function<void(World&)> run) {
+        System& system = addSystem(std::move(name), std::move(run));
+        system.exclusive = true;
+        return system;
+    }
+
+    /**
+     * @brief Runs every system once, concurrently where their access allows.
+     * @param world The world the systems operate on. Its JobSystem resource, if any, executes them.
+     * @details Each system becomes a job whose dependencies are the earlier systems it conflicts with.
+     *          Returns when every system has finished.
+     */
+    void run(World& world) {
+        if (systems.empty()) return;
+        if (graphDirty) buildGraph();
+
+        JobSystem* jobs = world.getResource<JobSystem>();
+        if (!jobs || jobs->size() == 0 || systems.size() == 1) {
+            // Registration order is always a valid order of the dependency graph
+            for (System& system : systems) {
+                if (system.run) system.run(world);
+            }
+            return;
+        }
+
+        std::vector<JobHandle> handles(systems.size());
+        std::vector<JobHandle> waitFor;
+        for (size_t i = 0; i < systems.size(); ++i) {
+            waitFor.clear();
+            for (size_t earlier : dependencies[i]) {
+                waitFor.push_back(handles[earlier]);
+            }
+
+            System& system = systems[i];
+            handles[i] = jobs->schedule([&world, &system] {
+                if (system.run) system.run(world);
+            }, waitFor);
+        }
+
+        for (const JobHandle& handle : handles) {
+            jobs->wait(handle);
+        }
+    }
+
+    /**
+     * @brief Retrieves the registered systems, in registration order.
+     */
+    const std::vector<System>& getSystems() const { return systems; }
+
+    /**
+     * @brief Retrieves the earlier systems a given system waits for.
+     * @param system Index of the system in getSystems().
+     */
+    const std::vector<size_t>& getDependencies(size_t system) {
+        if (graphDirty) buildGraph();
+        return dependencies[system];
+    }
+
+private:
+    /**
+     * @brief Links every system to the earlier systems it conflicts with.
+     * @details Only the nearest conflicting predecessors would be strictly needed; linking all of them keeps
+     *          the graph trivially correct and costs nothing noticeable for the handful of systems per pass.
+     */
+    void buildGraph() {
+        dependencies.assign(systems.size(), {});
+        for (size_t later = 0; later < systems.size(); ++later) {
+            for (size_t earlier = 0; earlier < later; ++earlier) {
+                if (systems[earlier].conflictsWith(systems[later])) {
+                    dependencies[later].push_back(earlier);
+                }
+            }
+        }
+        graphDirty = false;
+    }
+};
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include "GameTypes.h"
 #include "Entity.h"
+#include "DamageKernel.h"
+#include "Effect.h"
 #include <functional>
 #include <vector>
 #include <string>
@@ -10,15 +12,16 @@
  * @Author: Miguel Angel Garcia Elizalde
  * @Date: October, 2025
  * @file: Skill.h
- * @brief: Defines the Skill system for turn-based combat actions using lambda-based effects.
- * @details: Implements a flexible skill system where combat abilities are defined as composable lambda functions,
- *           enabling easy creation of new skills without modifying core combat logic.
+ * @brief: Defines the Skill system for turn-based combat actions using bytecode or lambda-based effects.
+ * @details: Implements a flexible skill system where combat abilities are defined as data-driven Effect programs
+ *           (see Effect.h) or, for one-off behaviour, as lambda functions, enabling easy creation of new skills
+ *           without modifying core combat logic.
  */
 
  /**
   * @brief Encapsulates a combat skill with name, resource cost, and executable effect.
   * @details Skills use the Command Pattern to encapsulate combat actions as first-class objects.
-  *          Each skill contains a lambda function that defines its gameplay behavior when executed.
+  *          Each skill contains an Effect program or a lambda function that defines its gameplay behavior.
   */
 class Skill {
 public:
@@ -33,27 +36,48 @@ public:
      * @param skillName The display name used in UI and logging.
      * @param skillEffect Lambda function defining the skill's gameplay logic and side effects.
      * @param manaCost Resource cost required to execute this skill (default: 0).
-     * @note The skillEffect lambda should handle its own validation and state modifications.
+     * @note The skillEffect lambda should handle its own validation and state modifications, and record
+     *       structural changes (tags, spawns, destruction) on the CommandBuffer it receives.
      */
     Skill(const std::string& skillName,
-        std::function<void(Entity&, Entity&)> skillEffect,
+        std::function<void(Entity&, Entity&, CommandBuffer&)> skillEffect,
         int manaCost = 0)
         : name(skillName), effect(std::move(skillEffect)), cost(manaCost) {
     }
 
+    /**
+     * @brief Constructs a Skill whose behavior is an Effect program.
+     * @param skillName The display name used in UI and logging.
+     * @param skillProgram Bytecode run by executeEffect() against the entities' components.
+     * @param manaCost Resource cost required to execute this skill (default: 0).
+     */
+    Skill(const std::string& skillName, Effect skillProgram, int manaCost = 0)
+        : name(skillName), program(std::move(skillProgram)), cost(manaCost) {
+    }
+
     /**
      * @brief Executes this skill's effect on the specified target entity.
      * @param user The entity initiating the skill (consumes resources).
      * @param target The entity receiving the skill's effects.
-     * @note Performs null-check on the effect lambda before execution.
+     * @param commands Receives the skill's structural changes, such as a defeated target's tag swap.
+     * @note Runs the Effect program if there is one, the effect lambda otherwise.
      * @warning Both entities must have required components for the skill to function properly.
      */
-    void execute(Entity& user, Entity& target) {
-        if (effect) {
-            effect(user, target);
+    void execute(Entity& user, Entity& target, CommandBuffer& commands) {
+        if (!program.empty() && user.getWorld()) {
+            executeEffect(program, *user.getWorld(), commands, user.getId(), target.getId());
+        }
+        else if (effect) {
+            effect(user, target, commands);
         }
     }
 
+    /**
+     * @brief Retrieves the skill's Effect program.
+     * @return The program; empty for lambda-based skills.
+     */
+    const Effect& getProgram() const { return program; }
+
     /**
      * @brief Retrieves the display name of the skill.
      * @return Constant reference to the skill's name string.
@@ -68,7 +92,8 @@ public:
 
 private:
     std::string name;                                   ///< Display name for UI and debugging
-    std::function<void(Entity&, Entity&)> effect;      ///< Lambda defining skill behavior
+    std::function<void(Entity&, Entity&, CommandBuffer&)> effect;  ///< Lambda defining skill behavior, if there is no program
+    Effect program;                                     ///< Bytecode defining skill behavior
     int cost{ 0 };                                       ///< Mana resource cost for execution
 };
 
@@ -86,21 +111,18 @@ public:
      *          Guarantees minimum 1 damage and handles entity defeat state.
      */
     static Skill createAttackSkill() {
-        return Skill("Basic Attack", [](Entity& user, Entity& target) {
-            auto* userStats = user.getComponent<HealthComponent>();
-            auto* targetStats = target.getComponent<HealthComponent>();
-            if (userStats && targetStats && targetStats->isAlive) {
-                int damage = std::max(1, userStats->stats.attack - targetStats->stats.defense / 2);
-                targetStats->stats.health -= damage;
-                std::cout << "Basic attack! " << damage << " damage to "
-                    << target.getComponent<TransformComponent>()->name << ".\n";
-
-                if (targetStats->stats.health <= 0) {
-                    targetStats->isAlive = false;
-                    std::cout << target.getComponent<TransformComponent>()->name << " has been defeated!\n";
-                }
-            }
-            });
+        EffectBuilder b;
+        b.op(EffectOp::IsAlive, EffectSubject::Target);
+        size_t targetDown = b.jumpIfZero();
+        b.load(EffectSubject::User, EffectStat::Attack)
+         .load(EffectSubject::Target, EffectStat::Defense)
+         .op(EffectOp::AttackDamage)
+         .op(EffectOp::Dup).op(EffectOp::Damage, EffectSubject::Target)
+         .log("Basic attack! {value} damage to {target}.")
+         .op(EffectOp::DefeatIfDown, EffectSubject::Target)
+         .bind(targetDown)
+         .op(EffectOp::Return);
+        return Skill("Basic Attack", b.build());
     }
 
     /**
@@ -110,22 +132,17 @@ public:
      *          Includes mana validation and heal amount calculation.
      */
     static Skill createHealSkill() {
-        return Skill("Heal", [](Entity& user, Entity& target) {
-            auto* userStats = user.getComponent<HealthComponent>();
-            auto* targetStats = target.getComponent<HealthComponent>();
-            if (userStats && targetStats && userStats->stats.mana >= 10) {
-                int heal = targetStats->stats.maxHealth / 3;
-                int oldHealth = targetStats->stats.health;
-                targetStats->stats.health = std::min(targetStats->stats.maxHealth, targetStats->stats.health + heal);
-                int actualHeal = targetStats->stats.health - oldHealth;
-                userStats->stats.mana -= 10;
-                std::cout << "Heal performed! " << actualHeal << " health restored to "
-                    << target.getComponent<TransformComponent>()->name << ".\n";
-            }
-            else if (userStats && userStats->stats.mana < 10) {
-                std::cout << "Not enough mana to heal!\n";
-            }
-            }, 10);
+        EffectBuilder b;
+        b.load(EffectSubject::User, EffectStat::Mana).push(10).op(EffectOp::Less);
+        size_t enoughMana = b.jumpIfZero();
+        b.log("Not enough mana to heal!").op(EffectOp::Return)
+         .bind(enoughMana)
+         .load(EffectSubject::Target, EffectStat::MaxHealth).push(3).op(EffectOp::Div)
+         .op(EffectOp::Heal, EffectSubject::Target)
+         .push(10).op(EffectOp::SpendMana, EffectSubject::User)
+         .log("Heal performed! {value} health restored to {target}.")
+         .op(EffectOp::Return);
+        return Skill("Heal", b.build(), 10);
     }
 
     /**
@@ -134,25 +151,19 @@ public:
      * @details Deals double attack damage with mana cost. Includes mana validation.
      */
     static Skill createFireballSkill() {
-        return Skill("Fireball", [](Entity& user, Entity& target) {
-            auto* userStats = user.getComponent<HealthComponent>();
-            auto* targetStats = target.getComponent<HealthComponent>();
-            if (userStats && targetStats && userStats->stats.mana >= 15) {
-                int damage = userStats->stats.attack * 2 - targetStats->stats.defense / 2;
-                damage = std::max(1, damage);
-                targetStats->stats.health -= damage;
-                userStats->stats.mana -= 15;
-                std::cout << "Fireball cast! " << damage << " fire damage to "
-                    << target.getComponent<TransformComponent>()->name << ".\n";
-
-                if (targetStats->stats.health <= 0) {
-                    targetStats->isAlive = false;
-                    std::cout << target.getComponent<TransformComponent>()->name << " has been defeated!\n";
-                }
-            }
-            else if (userStats && userStats->stats.mana < 15) {
-                std::cout << "Not enough mana to cast Fireball!\n";
-            }
-            }, 15);
+        EffectBuilder b;
+        b.load(EffectSubject::User, EffectStat::Mana).push(15).op(EffectOp::Less);
+        size_t enoughMana = b.jumpIfZero();
+        b.log("Not enough mana to cast Fireball!").op(EffectOp::Return)
+         .bind(enoughMana)
+         .load(EffectSubject::User, EffectStat::Attack).push(2).op(EffectOp::Mul)
+         .load(EffectSubject::Target, EffectStat::Defense)
+         .op(EffectOp::AttackDamage)
+         .op(EffectOp::Dup).op(EffectOp::Damage, EffectSubject::Target)
+         .push(15).op(EffectOp::SpendMana, EffectSubject::User)
+         .log("Fireball cast! {value} fire damage to {target}.")
+         .op(EffectOp::DefeatIfDown, EffectSubject::Target)
+         .op(EffectOp::Return);
+        return Skill("Fireball", b.build(), 15);
     }
 };
\ No newline at end of file
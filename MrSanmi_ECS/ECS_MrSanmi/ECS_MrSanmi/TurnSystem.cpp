@@ -5,7 +5,7 @@
 /**
  * @brief Initializes the battle system with participating entities.
  */
-void TurnSystem::initializeBattle(const std::vector<Ref<Entity>>& entities) {
+void TurnSystem::initializeBattle(const std::vector<EntityId>& entities) {
     battleEntities = entities;
     calculateTurnOrder();
 
@@ -14,27 +14,48 @@ void TurnSystem::initializeBattle(const std::vector<Ref<Entity>>& entities) {
     startNextTurn();
 }
 
+/**
+ * @brief Replaces the participants considered when the next turn order is calculated.
+ */
+void TurnSystem::setParticipants(const std::vector<EntityId>& entities) {
+    battleEntities = entities;
+}
+
+/**
+ * @brief Returns the system to its pre-battle state.
+ */
+void TurnSystem::reset() {
+    while (!turnQueue.empty()) turnQueue.pop();
+    battleEntities.clear();
+    battleStatus() = BattleStatus{};
+    turnCounter() = TurnCounter{};
+    healthChanges.clear();
+    lifeChanges.clear();
+    commands.clear();
+}
+
 /**
  * @brief Calculates and sorts turn order based on entity speed and team priority.
  */
 void TurnSystem::calculateTurnOrder() {
     // Clear previous queue
     while (!turnQueue.empty()) turnQueue.pop();
+    TurnCounter& turns = turnCounter();
+    ++turns.round;
+    turns.roundStart = turns.turn + 1;
 
-    for (const auto& entity : battleEntities) {
-        if (auto* health = entity->getComponent<HealthComponent>()) {
-            if (health->isAlive) {
+    for (EntityId entity : battleEntities) {
+        if (auto* base = world.readComponent<CombatBaseStats>(entity)) {
+            if (world.hasComponent<Alive>(entity)) {
                 TurnOrder order;
                 order.entity = entity;
-                order.speed = health->stats.speed;
+                order.speed = base->speed;
 
                 // Give priority to players over enemies
-                if (auto* transform = entity->getComponent<TransformComponent>()) {
-                    order.priority = (transform->team == Team::PLAYER) ? 1 : 0;
-                }
+                order.priority = world.hasComponent<PlayerTeam>(entity) ? 1 : 0;
 
                 turnQueue.push(order);
-                std::cout << "DEBUG - " << order.entity->getComponent<TransformComponent>()->name
+                std::cout << "DEBUG - " << world.readComponent<DisplayInfo>(order.entity)->name
                     << " added to queue (speed: " << order.speed << ")\n";
             }
         }
@@ -47,6 +68,16 @@ void TurnSystem::calculateTurnOrder() {
 void TurnSystem::startNextTurn() {
     std::cout << "DEBUG - Starting next turn...\n";
 
+    // Resolve defeats first, so neither a finished battle nor a defeated actor gets another turn
+    updateEntityStatus();
+    checkBattleConditions();
+    if (!isBattleActive()) return;
+
+    // Skip queued actors that were defeated or released since the queue was built
+    while (!turnQueue.empty() && !world.hasComponent<Alive>(turnQueue.top().entity)) {
+        turnQueue.pop();
+    }
+
     if (turnQueue.empty()) {
         calculateTurnOrder();
         if (turnQueue.empty()) {
@@ -55,24 +86,27 @@ void TurnSystem::startNextTurn() {
         }
     }
 
-    currentActor = turnQueue.top().entity;
+    EntityId actor = turnQueue.top().entity;
     turnQueue.pop();
+    battleStatus().currentActor = actor;
+    ++turnCounter().turn;
 
+    // Turn start systems may touch any resource, so they are looked up again afterwards
     executeTurnStartEvents();
-    updateEntityStatus();
 
     std::cout << "\n--- NEW TURN ---\n";
-    if (auto* transform = currentActor->getComponent<TransformComponent>()) {
-        std::cout << "Turn of: " << transform->name << "\n";
+    if (auto* display = world.readComponent<DisplayInfo>(actor)) {
+        const TurnCounter& turns = turnCounter();
+        std::cout << "Turn of: " << display->name << " (turn " << turns.turn << ", round " << turns.round << ")\n";
     }
 
     // Determine next state based on team
-    if (auto* transform = currentActor->getComponent<TransformComponent>()) {
-        BattleState nextState = (transform->team == Team::PLAYER) ?
+    if (world.isAlive(actor)) {
+        BattleState nextState = world.hasComponent<PlayerTeam>(actor) ?
             BattleState::PLAYER_CHOICE :
             BattleState::ENEMY_THINKING;
         std::cout << "DEBUG - Changing to state: " << static_cast<int>(nextState) << "\n";
-        currentState = nextState;
+        battleStatus().state = nextState;
     }
 }
 
@@ -81,6 +115,9 @@ void TurnSystem::startNextTurn() {
  */
 void TurnSystem::endCurrentTurn() {
     executeTurnEndEvents();
+
+    // Sync point: apply structural changes recorded during the turn
+    commands.flush();
     checkBattleConditions();
 
     if (isBattleActive()) {
@@ -92,12 +129,13 @@ void TurnSystem::endCurrentTurn() {
  * @brief Transitions the battle to a new state.
  */
 void TurnSystem::setState(BattleState newState) {
-    std::cout << "DEBUG - Changing state from " << static_cast<int>(currentState)
+    BattleStatus& status = battleStatus();
+    std::cout << "DEBUG - Changing state from " << static_cast<int>(status.state)
         << " to " << static_cast<int>(newState) << "\n";
-    currentState = newState;
+    status.state = newState;
 
     // Automatic logic for state transitions
-    switch (currentState) {
+    switch (newState) {
     case BattleState::ENEMY_THINKING:
         std::cout << "The enemy is thinking...\n";
         setState(BattleState::ACTION_EXECUTE);
@@ -123,78 +161,67 @@ void TurnSystem::setState(BattleState newState) {
  * @brief Subscribes a callback to turn start events.
  */
 void TurnSystem::subscribeToTurnStart(BattleEvent event) {
-    onTurnStartEvents.push_back(std::move(event));
+    turnStartSystems.addExclusiveSystem("turn start event", std::move(event));
 }
 
 /**
  * @brief Subscribes a callback to turn end events.
  */
 void TurnSystem::subscribeToTurnEnd(BattleEvent event) {
-    onTurnEndEvents.push_back(std::move(event));
+    turnEndSystems.addExclusiveSystem("turn end event", std::move(event));
 }
 
 /**
- * @brief Executes all registered turn start event callbacks.
+ * @brief Runs the turn start systems.
  */
 void TurnSystem::executeTurnStartEvents() {
-    for (const auto& event : onTurnStartEvents) {
-        if (event) event();
-    }
+    turnStartSystems.run(world);
 }
 
 /**
- * @brief Executes all registered turn end event callbacks.
+ * @brief Runs the turn end systems.
  */
 void TurnSystem::executeTurnEndEvents() {
-    for (const auto& event : onTurnEndEvents) {
-        if (event) event();
-    }
+    turnEndSystems.run(world);
 }
 
 /**
  * @brief Updates entity status based on current health values.
  */
 void TurnSystem::updateEntityStatus() {
-    for (auto& entity : battleEntities) {
-        if (auto* health = entity->getComponent<HealthComponent>()) {
-            if (health->stats.health <= 0) {
-                health->isAlive = false;
-                health->stats.health = 0;
-                if (auto* transform = entity->getComponent<TransformComponent>()) {
-                    std::cout << transform->name << " has been defeated!\n";
-                }
+    // Only entities whose health was touched since the last pass can have just been defeated
+    healthChanges.drain([&](EntityId entity) {
+        const auto* state = world.readComponent<CombatState>(entity);
+        if (!state || state->health > 0) return;
+
+        if (state->health < 0) {
+            world.getComponent<CombatState>(entity)->health = 0;
+        }
+
+        if (world.hasComponent<Alive>(entity)) {
+            world.removeComponent<Alive>(entity);
+            world.addComponent<Dead>(entity);
+            if (auto* display = world.readComponent<DisplayInfo>(entity)) {
+                std::cout << display->name << " has been defeated!\n";
             }
         }
-    }
+    });
 }
 
 /**
  * @brief Evaluates victory/defeat conditions based on entity status.
  */
 void TurnSystem::checkBattleConditions() {
-    bool playersAlive = false;
-    bool enemiesAlive = false;
-
-    for (const auto& entity : battleEntities) {
-        if (auto* health = entity->getComponent<HealthComponent>()) {
-            if (health->isAlive) {
-                if (auto* transform = entity->getComponent<TransformComponent>()) {
-                    if (transform->team == Team::PLAYER) {
-                        playersAlive = true;
-                    }
-                    else {
-                        enemiesAlive = true;
-                    }
-                }
-            }
-        }
-    }
+    // The outcome can only change when someone was defeated, revived or joined the battle
+    if (lifeChanges.empty()) return;
+    lifeChanges.clear();
 
-    if (!playersAlive) {
+    // Team and status are archetype tags, so this only checks the sizes of the cached matching archetypes
+    if (livingPlayers.empty()) {
         setState(BattleState::DEFEAT);
         std::cout << "=== DEFEAT ===\n";
     }
-    else if (!enemiesAlive) {
+    else if (livingEnemies.empty()) {
         setState(BattleState::VICTORY);
         std::cout << "=== VICTORY ===\n";
     }
@@ -204,6 +231,27 @@ void TurnSystem::checkBattleConditions() {
  * @brief Checks if the battle is currently active.
  */
 bool TurnSystem::isBattleActive() const {
-    return currentState != BattleState::VICTORY &&
-        currentState != BattleState::DEFEAT;
+    BattleState state = battleStatus().state;
+    return state != BattleState::VICTORY &&
+        state != BattleState::DEFEAT;
+}
+
+/**
+ * @brief Retrieves the world's BattleStatus resource.
+ */
+BattleStatus& TurnSystem::battleStatus() const {
+    if (BattleStatus* status = world.getResource<BattleStatus>()) {
+        return *status;
+    }
+    return world.insertResource<BattleStatus>();
+}
+
+/**
+ * @brief Retrieves the world's TurnCounter resource.
+ */
+TurnCounter& TurnSystem::turnCounter() const {
+    if (TurnCounter* turns = world.getResource<TurnCounter>()) {
+        return *turns;
+    }
+    return world.insertResource<TurnCounter>();
 }
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 #include "GameTypes.h"
 #include "Entity.h"
-#include "Skill.h"
+#include "BattleResources.h"
+#include "CommandBuffer.h"
+#include "Query.h"
+#include "Scheduler.h"
 #include <queue>
 #include <memory>
 
@@ -20,7 +23,7 @@
   */
 struct TurnOrder
 {
-    Ref<Entity> entity;     ///< Reference to the entity taking the turn
+    EntityId entity;          ///< Handle of the entity taking the turn
     int speed{ 0 };           ///< Speed stat used for ordering (higher = acts sooner)
     int priority{ 0 };        ///< Team-based priority (players > enemies)
 
@@ -47,39 +50,80 @@ class TurnSystem
 {
 private:
     // Core System State
+    World& world;                                       ///< Storage holding the components of every participant
     std::priority_queue<TurnOrder> turnQueue;           ///< Priority queue determining turn order
-    std::vector<Ref<Entity>> battleEntities;           ///< All entities participating in the battle
-    BattleState currentState{ BattleState::TURN_START }; ///< Current phase of battle execution
-    Ref<Entity> currentActor;                          ///< Entity currently permitted to take actions
+    std::vector<EntityId> battleEntities;              ///< All entities participating in the battle
+    Observer& healthChanges;                           ///< Entities whose health changed since the last status update
+    Observer& lifeChanges;                             ///< Entities that gained or lost Alive since the last condition check
+    CommandBuffer commands;                            ///< Structural changes deferred until the turn ends
+    Query<> livingPlayers;                             ///< Entities tagged Alive and PlayerTeam
+    Query<> livingEnemies;                             ///< Entities tagged Alive and EnemyTeam
 
     // Event System
-    std::vector<BattleEvent> onTurnStartEvents;        ///< Callbacks executed when a turn begins
-    std::vector<BattleEvent> onTurnEndEvents;          ///< Callbacks executed when a turn ends
+    Scheduler turnStartSystems;                        ///< Systems and callbacks executed when a turn begins
+    Scheduler turnEndSystems;                          ///< Systems and callbacks executed when a turn ends
 
 public:
+    /**
+     * @brief Constructs a TurnSystem operating on the given world.
+     * @param battleWorld The world storing the components of the battle's entities.
+     * @details Inserts the BattleStatus and TurnCounter resources, so other systems can read the battle
+     *          phase and current actor from the world alone. The system itself looks them up on every use
+     *          instead of keeping references, so replacing or removing them never leaves it dangling.
+     */
+    explicit TurnSystem(World& battleWorld)
+        : world(battleWorld),
+          healthChanges(battleWorld.observe<CombatState>(ComponentEvent::Changed)),
+          lifeChanges(battleWorld.observe<Alive>(ComponentEvent::Added | ComponentEvent::Removed)),
+          commands(battleWorld),
+          livingPlayers(battleWorld.query<>()),
+          livingEnemies(battleWorld.query<>()) {
+        world.insertResource<BattleStatus>();
+        world.insertResource<TurnCounter>();
+        livingPlayers.with<Alive, PlayerTeam>();
+        livingEnemies.with<Alive, EnemyTeam>();
+    }
+
     // Battle Lifecycle Management
     /**
      * @brief Initializes the battle system with participating entities.
      * @param entities Collection of all entities involved in the battle.
      * @details Calculates initial turn order and transitions to first turn.
      */
-    void initializeBattle(const std::vector<Ref<Entity>>& entities);
+    void initializeBattle(const std::vector<EntityId>& entities);
+
+    /**
+     * @brief Returns the system to its pre-battle state.
+     * @details Clears the turn queue, participants, current actor, turn counter and pending commands.
+     *          Event subscriptions are kept.
+     */
+    void reset();
+
+    /**
+     * @brief Replaces the participants considered when the next turn order is calculated.
+     * @param entities Current battle participants, e.g. after a new wave joined or defeated ones were released.
+     * @details The turn already queued is kept; released entities in it are skipped.
+     */
+    void setParticipants(const std::vector<EntityId>& entities);
 
     /**
      * @brief Calculates and sorts turn order based on entity speed and team priority.
      * @details Only includes alive entities. Players receive higher priority than enemies.
+     *          Handles of destroyed entities are skipped.
      */
     void calculateTurnOrder();
 
     /**
      * @brief Advances to the next entity's turn in the queue.
-     * @details Executes turn start events, updates entity status, and determines next battle state.
+     * @details Updates entity status and ends the battle if a side was wiped out; otherwise skips defeated
+     *          actors, executes turn start events, and determines next battle state.
      */
     void startNextTurn();
 
     /**
      * @brief Completes the current turn and advances battle state.
-     * @details Executes turn end events, checks battle conditions, and triggers next turn if battle continues.
+     * @details Executes turn end events, flushes deferred structural changes, checks battle conditions,
+     *          and triggers next turn if battle continues.
      */
     void endCurrentTurn();
 
@@ -95,29 +139,51 @@ public:
      * @brief Retrieves the current battle state.
      * @return The current BattleState enum value.
      */
-    BattleState getCurrentState() const { return currentState; }
+    BattleState getCurrentState() const { return battleStatus().state; }
 
     /**
      * @brief Retrieves the entity currently taking actions.
-     * @return Shared pointer to the active entity.
+     * @return Handle of the active entity (null before the battle starts).
+     */
+    EntityId getCurrentActor() const { return battleStatus().currentActor; }
+
+    /**
+     * @brief Provides the buffer for structural changes made during a turn.
+     * @return Reference to the command buffer flushed at the end of every turn.
+     * @details Skills and turn events should spawn, destroy, add or remove components through it instead of
+     *          touching the world directly, so systems iterating the world never see storage move underneath.
      */
-    Ref<Entity> getCurrentActor() const { return currentActor; }
+    CommandBuffer& getCommandBuffer() { return commands; }
 
     // Event System
     /**
      * @brief Subscribes a callback to turn start events.
-     * @param event Callback function to execute when a turn begins.
-     * @note Callbacks are executed in subscription order.
+     * @param event Callback executed with the battle's world when a turn begins.
+     * @note Callbacks declare no data access, so each runs alone, in subscription order relative to the
+     *       other turn start systems.
      */
     void subscribeToTurnStart(BattleEvent event);
 
     /**
      * @brief Subscribes a callback to turn end events.
-     * @param event Callback function to execute when a turn ends.
-     * @note Callbacks are executed in subscription order.
+     * @param event Callback executed with the battle's world when a turn ends.
+     * @note Callbacks declare no data access, so each runs alone, in subscription order relative to the
+     *       other turn end systems.
      */
     void subscribeToTurnEnd(BattleEvent event);
 
+    /**
+     * @brief Provides the systems run at the start of every turn.
+     * @return Reference to the scheduler; systems added with declared access may run concurrently.
+     */
+    Scheduler& getTurnStartSystems() { return turnStartSystems; }
+
+    /**
+     * @brief Provides the systems run at the end of every turn, before deferred commands are flushed.
+     * @return Reference to the scheduler; systems added with declared access may run concurrently.
+     */
+    Scheduler& getTurnEndSystems() { return turnEndSystems; }
+
     // Battle Status Queries
     /**
      * @brief Checks if the battle is currently active.
@@ -127,25 +193,41 @@ public:
 
     /**
      * @brief Evaluates victory/defeat conditions based on entity status.
-     * @details Checks if all players or all enemies have been defeated.
+     * @details Does nothing unless some entity gained or lost the Alive tag since the last check. Otherwise
+     *          checks if all players or all enemies have been defeated through tag-filtered views, which only
+     *          visit archetypes holding living members of each team.
      */
     void checkBattleConditions();
 
 private:
+    // Battle Resources
+    /**
+     * @brief Retrieves the world's BattleStatus resource.
+     * @return The stored resource; a default one is inserted if it was removed.
+     */
+    BattleStatus& battleStatus() const;
+
+    /**
+     * @brief Retrieves the world's TurnCounter resource.
+     * @return The stored resource; a default one is inserted if it was removed.
+     */
+    TurnCounter& turnCounter() const;
+
     // Internal Event Processing
     /**
-     * @brief Executes all registered turn start event callbacks.
+     * @brief Runs the turn start systems.
      */
     void executeTurnStartEvents();
 
     /**
-     * @brief Executes all registered turn end event callbacks.
+     * @brief Runs the turn end systems.
      */
     void executeTurnEndEvents();
 
     /**
      * @brief Updates entity status based on current health values.
-     * @details Marks entities as defeated if health drops to zero or below.
+     * @details Marks entities as defeated if health drops to zero or below. Only the entities reported by
+     *          the health observer since the last update are inspected.
      */
     void updateEntityStatus();
 };
\ No newline at end of file
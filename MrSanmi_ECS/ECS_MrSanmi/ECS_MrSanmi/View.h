@@ -0,0 +1,502 @@
+#pragma once
+#include "World.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: View.h
+ * @brief: Typed multi-component queries over World storage.
+ * @details: A View yields only the entities owning every requested component and hands the components to
+ *           a callback by reference. Table components are read straight from the chunk columns of matching archetypes;
+ *           sparse-set components are resolved through their pool's sparse array. No hashing, no per-entity
+ *           handle construction and no temporary entity lists are involved.
+ *           Non-const components handed to a callback are stamped with the world's change tick and reported
+ *           to Changed observers; eachChanged visits only entities whose component changed after a given tick.
+ *           Tag components are filtered with with<>() and without<>(); they test archetype signatures only.
+ *           parEach and parReduce split the matching entities into work items and run them on the World's JobSystem.
+ */
+
+/**
+ * @brief Archetypes matched by a Query, extended as the World creates new archetypes.
+ */
+struct QueryCache {
+    std::vector<Archetype*> archetypes;     ///< Matching archetypes, in creation order
+    size_t scanned{ 0 };                    ///< Number of world archetypes already tested
+    uint32_t generation{ 0 };               ///< World archetype generation the cache was built for
+};
+
+/**
+ * @brief How parEach and parReduce group their work items into jobs.
+ */
+enum class ParallelMode : uint8_t {
+    Fast,           ///< A few batches per worker; reductions depend on the worker count
+    Deterministic   ///< One job and one partial result per work item, combined in storage order (the default)
+};
+
+ /**
+  * @brief Query over every entity that owns all component types Ts.
+  * @tparam Ts Component types to match. Const-qualified types are handed to callbacks as const references.
+  * @details Views are cheap to create and hold no results; iteration walks the World's storage directly.
+  *          When at least one table component is requested, matching archetypes drive the iteration.
+  *          When every component is sparse-set stored, the smallest pool drives it.
+  *          Tags cannot be requested as Ts since they have no data to hand out; filter on them with with<>().
+  * @warning Do not add or remove components or entities while iterating a view.
+  */
+template<typename... Ts>
+class View {
+private:
+    template<typename T>
+    using Stored = std::remove_const_t<T>;
+
+    template<typename T>
+    static constexpr bool isSparse = ComponentStorage<Stored<T>>::type == StorageType::SparseSet;
+
+    static_assert(((ComponentStorage<Stored<Ts>>::type != StorageType::Tag) && ...),
+                  "Tags carry no data; filter on them with with<>() or without<>()");
+
+    /// Per-component data source: an archetype column for table components, the pool for sparse ones.
+    template<typename T>
+    using Source = std::conditional_t<isSparse<T>, ComponentPool<Stored<T>>*, ColumnSlice<Stored<T>>>;
+
+    static constexpr bool hasTableComponent = (!isSparse<Ts> || ...);
+
+    /// Signature an archetype must contain: the requested table components only.
+    static constexpr ComponentMask tableMask = [] {
+        ComponentMask mask;
+        ((isSparse<Ts> ? void() : mask.set(componentId<Stored<Ts>>)), ...);
+        return mask;
+    }();
+
+    /// Entities per work item when a sparse-set pool drives a parallel iteration.
+    static constexpr size_t ParallelGrain = 1024;
+
+    /// Unit of parallel work: one archetype chunk, or a range of the driving pool's dense entity array.
+    struct WorkItem {
+        Archetype* archetype{ nullptr };                    ///< Archetype owning the chunk, or nullptr for a pool range
+        const ArenaVector<EntityId>* entities{ nullptr };   ///< Dense entities of the driving pool
+        size_t first{ 0 };                                  ///< Chunk index, or first dense index of the range
+        size_t last{ 0 };                                   ///< One past the last dense index of the range
+    };
+
+    using Pools = std::tuple<ComponentPool<Stored<Ts>>*...>;
+
+    World& world;                   ///< World being queried
+    ComponentMask required;         ///< Extra table/tag components a matching archetype must contain
+    ComponentMask excluded;         ///< Table/tag components a matching archetype must not contain
+    ComponentMask sparseRequired;   ///< Extra sparse-set components a matching entity must own
+    ComponentMask sparseExcluded;   ///< Sparse-set components a matching entity must not own
+    QueryCache* cache{ nullptr };   ///< Matching archetypes kept by the owning Query, or nullptr to test them all
+
+    template<typename... Us>
+    friend class Query;
+
+public:
+    /**
+     * @brief Constructs a view over the given world.
+     * @param queried The world whose entities are matched.
+     */
+    explicit View(World& queried) : world(queried) {}
+
+    /**
+     * @brief Restricts the view to entities that also own every component in Us.
+     * @tparam Us Component types to require without fetching them, typically tags.
+     * @return Reference to this view for chaining.
+     */
+    template<typename... Us>
+    View& with() {
+        ((isSparse<Us> ? sparseRequired.set(componentId<Stored<Us>>) : required.set(componentId<Stored<Us>>)), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Restricts the view to entities owning none of the components in Us.
+     * @tparam Us Component types to exclude, typically tags.
+     * @return Reference to this view for chaining.
+     */
+    template<typename... Us>
+    View& without() {
+        ((isSparse<Us> ? sparseExcluded.set(componentId<Stored<Us>>) : excluded.set(componentId<Stored<Us>>)), ...);
+        return *this;
+    }
+
+    /**
+     * @brief Invokes a callback for every entity owning all requested components.
+     * @tparam Func Callable with signature void(EntityId, Ts&...).
+     * @param fn The callback receiving the entity and references to its components.
+     */
+    template<typename Func>
+    void each(Func&& fn) {
+        iterate<void>(0, fn);
+    }
+
+    /**
+     * @brief Checks if no entity matches the view.
+     * @details Without sparse-set components or filters this only looks at archetype sizes.
+     */
+    bool empty() {
+        static_assert((std::is_const_v<Ts> && ...), "empty() would record changes to non-const components");
+        if (!(isSparse<Ts> || ...) && sparseRequired.none() && sparseExcluded.none()) {
+            bool found = false;
+            forEachArchetype([&](Archetype& archetype) { found = found || archetype.size() > 0; });
+            return !found;
+        }
+
+        bool found = false;
+        each([&](EntityId, Ts&...) { found = true; });
+        return !found;
+    }
+
+    /**
+     * @brief Invokes a callback only for matching entities whose component C changed after a tick.
+     * @tparam C One of the requested component types (with the same const qualification).
+     * @tparam Func Callable with signature void(EntityId, Ts&...).
+     * @param since Tick the caller last observed, usually a value returned by World::advanceChangeTick().
+     * @param fn The callback receiving the entity and references to its components.
+     * @details Chunks whose C column has not changed since the tick are skipped without visiting rows.
+     */
+    template<typename C, typename Func>
+    void eachChanged(Tick since, Func&& fn) {
+        static_assert((std::is_same_v<C, Ts> || ...), "eachChanged requires one of the view's component types");
+        iterate<C>(since, fn);
+    }
+
+    /**
+     * @brief Invokes a callback for every matching entity, spreading the entities over the World's JobSystem.
+     * @tparam Func Callable with signature void(EntityId, Ts&...). Called concurrently; it must only touch
+     *         the entity it is given.
+     * @param fn The callback receiving the entity and references to its components.
+     * @param mode How work items are grouped into jobs; Fast trades fewer jobs for worker-dependent batching.
+     * @details Work items are whole archetype chunks, so no two threads ever share a chunk. Without a JobSystem
+     *          resource the items run in order on the calling thread. Changed observers are notified once the
+     *          iteration is done, in the same order each() would have used.
+     * @example world.view<CombatState>().with<Alive>().parEach([](EntityId, CombatState& state) { state.mana += 5; });
+     */
+    template<typename Func>
+    void parEach(Func&& fn, ParallelMode mode = ParallelMode::Deterministic) {
+        struct Nothing {};
+        parReduce(Nothing{},
+                  [&fn](Nothing&, EntityId entity, Ts&... components) { fn(entity, components...); },
+                  [](Nothing, Nothing) { return Nothing{}; },
+                  mode);
+    }
+
+    /**
+     * @brief Folds every matching entity into a value, spreading the entities over the World's JobSystem.
+     * @tparam T Type of the reduced value.
+     * @tparam Func Callable with signature void(T& partial, EntityId, Ts&...), accumulating into a partial result.
+     * @tparam Combine Callable with signature T(T, T), merging two partial results.
+     * @param identity Initial value of every partial result.
+     * @param fn The callback accumulating one entity into its job's partial result.
+     * @param combine Merges partial results; called on the calling thread, in storage order.
+     * @param mode How work items are grouped into jobs; Fast trades fewer jobs for worker-dependent results.
+     * @return The combined value, or identity if no entity matches.
+     * @details In Deterministic mode every work item gets its own partial result, and work items depend only on
+     *          storage layout, so the result is bit-identical for any number of workers, including none.
+     */
+    template<typename T, typename Func, typename Combine>
+    T parReduce(T identity, Func&& fn, Combine&& combine, ParallelMode mode = ParallelMode::Deterministic) {
+        Pools pools{ world.findPool<Stored<Ts>>()... };
+        if (((isSparse<Ts> && !std::get<ComponentPool<Stored<Ts>>*>(pools)) || ...)) return identity;
+
+        std::vector<WorkItem> items = collectWork(pools);
+        if (items.empty()) return identity;
+
+        JobSystem* jobs = world.getResource<JobSystem>();
+        size_t grain = 1;
+        if (mode == ParallelMode::Fast) {
+            size_t batches = jobs ? std::max<size_t>(jobs->size() * 4, 1) : 1;
+            grain = (items.size() + batches - 1) / batches;
+        }
+
+        // Observer queues are not thread-safe: record who changed per item and notify afterwards
+        bool observed = ((!std::is_const_v<Ts> &&
+                          world.isObserved(componentId<Stored<Ts>>, ComponentEvent::Changed)) || ...);
+        std::vector<std::vector<EntityId>> changed(observed ? items.size() : 0);
+
+        std::vector<T> partials((items.size() + grain - 1) / grain, identity);
+        Tick now = world.getChangeTick();
+        auto process = [&](size_t first, size_t last) {
+            T& partial = partials[first / grain];
+            auto accumulate = [&](EntityId entity, Ts&... components) { fn(partial, entity, components...); };
+            for (size_t i = first; i < last; ++i) {
+                visitItem(items[i], pools, now, accumulate, observed ? &changed[i] : nullptr);
+            }
+        };
+
+        if (jobs) {
+            jobs->parallelFor(0, items.size(), grain, process);
+        }
+        else {
+            for (size_t first = 0; first < items.size(); first += grain) {
+                process(first, std::min(first + grain, items.size()));
+            }
+        }
+
+        for (const auto& entities : changed) {
+            for (EntityId entity : entities) notifyChanged(entity);
+        }
+
+        T result = std::move(identity);
+        for (T& partial : partials) {
+            result = combine(std::move(result), std::move(partial));
+        }
+        return result;
+    }
+
+private:
+    /**
+     * @brief Shared iteration behind each() and eachChanged().
+     * @tparam Changed Component type whose change tick filters entities, or void for no filter.
+     * @param since Entities are visited only if Changed was changed after this tick.
+     * @param fn The callback receiving the entity and references to its components.
+     */
+    template<typename Changed, typename Func>
+    void iterate(Tick since, Func& fn) {
+        Pools pools{ world.findPool<Stored<Ts>>()... };
+        if (((isSparse<Ts> && !std::get<ComponentPool<Stored<Ts>>*>(pools)) || ...)) return;
+
+        Tick now = world.getChangeTick();
+
+        if (usesArchetypes()) {
+            forEachArchetype([&](Archetype& archetype) {
+                for (size_t chunk = 0; chunk < archetype.chunkCount(); ++chunk) {
+                    visitChunk<Changed>(archetype, chunk, pools, since, now, fn, nullptr);
+                }
+            });
+        }
+        else if constexpr (!hasTableComponent && sizeof...(Ts) > 0) {
+            const ArenaVector<EntityId>& driver = drivingEntities(pools);
+            visitDense<Changed>(driver, 0, driver.size(), pools, since, now, fn, nullptr);
+        }
+    }
+
+    /**
+     * @brief Splits the matching entities into work items for parEach and parReduce.
+     * @return Work items in the order each() visits them.
+     */
+    std::vector<WorkItem> collectWork(const Pools& pools) {
+        std::vector<WorkItem> items;
+        if (usesArchetypes()) {
+            forEachArchetype([&](Archetype& archetype) {
+                for (size_t chunk = 0; chunk < archetype.chunkCount(); ++chunk) {
+                    items.push_back({ &archetype, nullptr, chunk, 0 });
+                }
+            });
+        }
+        else if constexpr (!hasTableComponent && sizeof...(Ts) > 0) {
+            const ArenaVector<EntityId>& driver = drivingEntities(pools);
+            for (size_t first = 0; first < driver.size(); first += ParallelGrain) {
+                items.push_back({ nullptr, &driver, first, std::min(first + ParallelGrain, driver.size()) });
+            }
+        }
+        return items;
+    }
+
+    /**
+     * @brief Visits the entities of one work item.
+     * @param deferred If set, receives the entities whose components were stamped instead of notifying observers.
+     */
+    template<typename Func>
+    void visitItem(const WorkItem& item, Pools& pools, Tick now, Func& fn, std::vector<EntityId>* deferred) {
+        if (item.archetype) {
+            visitChunk<void>(*item.archetype, item.first, pools, 0, now, fn, deferred);
+        }
+        else if constexpr (!hasTableComponent && sizeof...(Ts) > 0) {
+            visitDense<void>(*item.entities, item.first, item.last, pools, 0, now, fn, deferred);
+        }
+    }
+
+    /**
+     * @brief Visits the matching rows of one archetype chunk.
+     * @tparam Changed Component type whose change tick filters entities, or void for no filter.
+     * @param now Tick stamped on the visited components; unused when Ts is empty (e.g. Query<>).
+     */
+    template<typename Changed, typename Func>
+    void visitChunk(Archetype& archetype, size_t chunk, Pools& pools, Tick since, [[maybe_unused]] Tick now,
+                    Func& fn, std::vector<EntityId>* deferred) {
+        std::tuple<Source<Ts>...> sources{ sourceFor<Ts>(archetype, chunk, pools)... };
+        if constexpr (!std::is_void_v<Changed> && !isSparse<Changed>) {
+            if (*std::get<Source<Changed>>(sources).lastChanged <= since) return;
+        }
+
+        bool sparseFilter = !sparseRequired.none() || !sparseExcluded.none();
+        const EntityId* entities = archetype.chunkEntities(chunk);
+        size_t rows = archetype.chunkRows(chunk);
+        for (size_t row = 0; row < rows; ++row) {
+            EntityId entity = entities[row];
+            if constexpr (!std::is_void_v<Changed>) {
+                if (changeTickOf<Changed>(std::get<Source<Changed>>(sources), row, entity) <= since) continue;
+            }
+
+            if (sparseFilter && !matchesSparse(world.getMask(entity))) continue;
+
+            std::tuple<Ts*...> components{ fetch<Ts>(std::get<Source<Ts>>(sources), row, entity)... };
+            if ((std::get<Ts*>(components) && ...)) {
+                (stamp<Ts>(std::get<Source<Ts>>(sources), row, entity, now), ...);
+                deferred ? deferred->push_back(entity) : notifyChanged(entity);
+                fn(entity, *std::get<Ts*>(components)...);
+            }
+        }
+    }
+
+    /**
+     * @brief Visits the matching entities in a range of the driving pool's dense entity array.
+     * @tparam Changed Component type whose change tick filters entities, or void for no filter.
+     */
+    template<typename Changed, typename Func>
+    void visitDense(const ArenaVector<EntityId>& driver, size_t first, size_t last, Pools& pools, Tick since,
+                    Tick now, Func& fn, std::vector<EntityId>* deferred) {
+        for (size_t i = first; i < last; ++i) {
+            EntityId entity = driver[i];
+            ComponentMask mask = world.getMask(entity);
+            if (!mask.containsAll(componentMask<Ts...>) || mask.intersects(excluded) || !matchesSparse(mask)) continue;
+            if constexpr (!std::is_void_v<Changed>) {
+                if (std::get<ComponentPool<Stored<Changed>>*>(pools)->getChangeTick(entity.index) <= since) continue;
+            }
+
+            (stamp<Ts>(std::get<ComponentPool<Stored<Ts>>*>(pools), i, entity, now), ...);
+            deferred ? deferred->push_back(entity) : notifyChanged(entity);
+            fn(entity, *fetch<Ts>(std::get<ComponentPool<Stored<Ts>>*>(pools), i, entity)...);
+        }
+    }
+
+    /**
+     * @brief Invokes a callback for every archetype matching the view, in creation order.
+     * @details Uses the owning Query's cache when there is one, testing only archetypes created since the last call.
+     */
+    template<typename Func>
+    void forEachArchetype(Func&& fn) {
+        if (!cache) {
+            for (const auto& archetype : world.getArchetypes()) {
+                if (matches(*archetype)) fn(*archetype);
+            }
+            return;
+        }
+
+        const auto& archetypes = world.getArchetypes();
+        if (cache->generation != world.getArchetypeGeneration()) {
+            *cache = QueryCache{ {}, 0, world.getArchetypeGeneration() };
+        }
+        for (; cache->scanned < archetypes.size(); ++cache->scanned) {
+            if (matches(*archetypes[cache->scanned])) cache->archetypes.push_back(archetypes[cache->scanned].get());
+        }
+
+        for (Archetype* archetype : cache->archetypes) {
+            fn(*archetype);
+        }
+    }
+
+    /**
+     * @brief Checks if matching entities are found through archetypes rather than through a sparse-set pool.
+     * @details Tag filters live in archetype signatures, so they route even all-sparse views through the archetypes.
+     */
+    bool usesArchetypes() const {
+        return hasTableComponent || sizeof...(Ts) == 0 || !required.none();
+    }
+
+    /**
+     * @brief Picks the smallest pool's dense entity array to drive an all-sparse view.
+     */
+    static const ArenaVector<EntityId>& drivingEntities(const Pools& pools) {
+        const ArenaVector<EntityId>* driver = nullptr;
+        ((driver = (!driver || std::get<ComponentPool<Stored<Ts>>*>(pools)->size() < driver->size()) ?
+            &std::get<ComponentPool<Stored<Ts>>*>(pools)->entities() : driver), ...);
+        return *driver;
+    }
+
+    /**
+     * @brief Checks if an archetype's signature satisfies the requested table components and tag filters.
+     * @param archetype The archetype to test.
+     * @return True if the archetype's rows can satisfy this view.
+     */
+    bool matches(const Archetype& archetype) const {
+        return archetype.mask.containsAll(tableMask) && archetype.mask.containsAll(required) &&
+               !archetype.mask.intersects(excluded);
+    }
+
+    /**
+     * @brief Checks the with/without filters that name sparse-set components against an entity's mask.
+     */
+    bool matchesSparse(const ComponentMask& mask) const {
+        return mask.containsAll(sparseRequired) && !mask.intersects(sparseExcluded);
+    }
+
+    /**
+     * @brief Resolves where component T is read from while iterating a chunk.
+     */
+    template<typename T, typename Pools>
+    static Source<T> sourceFor(Archetype& archetype, size_t chunk, const Pools& pools) {
+        if constexpr (isSparse<T>) {
+            return std::get<ComponentPool<Stored<T>>*>(pools);
+        }
+        else {
+            return archetype.slice<Stored<T>>(chunk);
+        }
+    }
+
+    /**
+     * @brief Fetches component T of an entity from its source.
+     * @return Pointer to the component, or nullptr if a sparse-set pool has no entry for the entity.
+     */
+    template<typename T>
+    static T* fetch(Source<T> source, size_t row, EntityId entity) {
+        if constexpr (isSparse<T>) {
+            return source->get(entity.index);
+        }
+        else {
+            return &source.data[row];
+        }
+    }
+
+    /**
+     * @brief Retrieves the tick of the last change to component T of an entity.
+     */
+    template<typename T>
+    static Tick changeTickOf(Source<T> source, size_t row, EntityId entity) {
+        if constexpr (isSparse<T>) {
+            return source->getChangeTick(entity.index);
+        }
+        else {
+            return source.ticks[row];
+        }
+    }
+
+    /**
+     * @brief Records a change to component T of an entity, unless T is requested as const.
+     */
+    template<typename T>
+    static void stamp(Source<T> source, size_t row, EntityId entity, Tick tick) {
+        if constexpr (!std::is_const_v<T>) {
+            if constexpr (isSparse<T>) {
+                source->markChanged(entity.index, tick);
+            }
+            else {
+                source.markChanged(row, tick);
+            }
+        }
+    }
+
+    /**
+     * @brief Reports an entity to the Changed observers of every component requested as non-const.
+     * @param entity Entity to report; unused when Ts is empty or all const.
+     */
+    void notifyChanged([[maybe_unused]] EntityId entity) {
+        ((std::is_const_v<Ts> ? void() : world.notify(componentId<Stored<Ts>>, ComponentEvent::Changed, entity)), ...);
+    }
+};
+
+template<typename... Ts>
+View<Ts...> World::view() {
+    return View<Ts...>(*this);
+}
+
+template<typename... Ts>
+View<Ts...> World::view() const {
+    static_assert((std::is_const_v<Ts> && ...), "A const World only provides views over const components");
+    return View<Ts...>(const_cast<World&>(*this));
+}
\ No newline at end of file
@@ -0,0 +1,1250 @@
+#pragma once
+#include "Component.h"
+#include "ComponentPool.h"
+#include "Observer.h"
+#include <vector>
+#include <array>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <memory_resource>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: World.h
+ * @brief: Archetype-based component storage backing every Entity handle.
+ * @details: Entities sharing the same set of component types are grouped into an Archetype, which stores its
+ *           rows in fixed-size 16 KiB chunks holding one contiguous array per component type. Systems can walk
+ *           those arrays linearly instead of probing a per-entity map, and an Entity only needs to know where
+ *           its row lives.
+ *           Components whose ComponentStorage is SparseSet bypass archetypes and live in a ComponentPool.
+ *           All component arrays are allocated from a per-world pooled arena, so a battle's storage can be
+ *           released in bulk when it ends.
+ *           Every component stores the Tick of its last change next to its value. Mutable access stamps the
+ *           world's current tick, so systems can visit only what changed since they last ran.
+ *           Battle-global state that belongs to no entity (RNG, battle state, skill registry...) is stored as
+ *           typed resources, one instance per type, so systems only need the World to reach it.
+ *           Observers registered with observe() collect the entities whose components were added, removed or
+ *           changed, so reactive systems can process only those.
+ */
+
+/**
+ * @brief Size in bytes of one archetype chunk.
+ * @details Every chunk of an archetype holds the same number of rows, chosen so that the rows' entity IDs,
+ *          components and change ticks fit in one block of this size.
+ */
+constexpr size_t ChunkSize = 16 * 1024;
+
+/**
+ * @brief Type-erased description of one component type: its layout and how to move and destroy it.
+ * @details Lets an Archetype manage components inside raw chunk memory without knowing their concrete types.
+ *          Plain function pointers are used instead of a virtual interface, so components need no common base
+ *          class and carry no vtable pointer. Trivially copyable components are relocated with memcpy and are
+ *          never destroyed.
+ */
+struct ComponentTypeInfo {
+    size_t size;            ///< sizeof the component type
+    size_t alignment;       ///< alignof the component type
+    bool trivial;           ///< Trivially copyable: relocated bytewise, no destructor to run
+
+    /// Move-constructs a component into uninitialized memory; the source must still be destroyed.
+    void (*moveConstruct)(void* destination, void* source);
+
+    /// Destroys a component in place.
+    void (*destroy)(void* component);
+};
+
+/**
+ * @brief Type-erased description of component type T.
+ * @tparam T The component type.
+ */
+template<typename T>
+inline constexpr ComponentTypeInfo componentTypeInfo{
+    sizeof(T),
+    alignof(T),
+    std::is_trivially_copyable_v<T>,
+    [](void* destination, void* source) { new (destination) T(std::move(*static_cast<T*>(source))); },
+    [](void* component) { static_cast<T*>(component)->~T(); }
+};
+
+/**
+ * @brief One component column of one chunk.
+ * @tparam T The component type stored in the column.
+ */
+template<typename T>
+struct ColumnSlice {
+    T* data{ nullptr };             ///< Packed components, one per chunk row
+    Tick* ticks{ nullptr };         ///< Tick of the last change of each row, parallel to data
+    Tick* lastChanged{ nullptr };   ///< Newest tick in ticks, so unchanged chunks can be skipped whole
+
+    /**
+     * @brief Records a change to one row.
+     * @param row The chunk row that changed.
+     * @param tick The World's current change tick.
+     */
+    void markChanged(size_t row, Tick tick) {
+        ticks[row] = tick;
+        if (tick > *lastChanged) *lastChanged = tick;
+    }
+};
+
+/**
+ * @brief Group of entities that own exactly the same set of component types.
+ * @details Rows are stored in fixed-size chunks. Each chunk is a single block laid out as
+ *          [column change flags | entity IDs | one array per component | one tick array per component],
+ *          so every column of a chunk is contiguous and all of a row's data lives in the same block.
+ *          Chunks never move once allocated: growing an archetype adds a chunk instead of reallocating
+ *          existing rows. Row r lives in chunk r / capacity; removal moves the last row into the hole, so
+ *          every chunk but the last in use is full.
+ */
+struct Archetype {
+    ComponentMask mask;                                 ///< Signature of the table and tag components stored here
+    std::vector<ComponentId> types;                     ///< Sorted component IDs defining this archetype
+    std::vector<const ComponentTypeInfo*> columnTypes;  ///< Type information for each entry in types, same order
+    std::array<int, MaxComponents> columnIndex;         ///< ComponentId to column position (-1 if absent)
+
+private:
+    std::pmr::memory_resource* resource;    ///< Memory resource chunks are allocated from
+    ArenaVector<std::byte*> chunks;         ///< Allocated chunks; those past the rows in use are spares
+    std::vector<size_t> dataOffsets;        ///< Byte offset of each column's components within a chunk
+    std::vector<size_t> tickOffsets;        ///< Byte offset of each column's ticks within a chunk
+    size_t entityOffset{ 0 };               ///< Byte offset of the entity IDs within a chunk
+    size_t capacity{ 0 };                   ///< Rows per chunk
+    size_t chunkBytes{ 0 };                 ///< Allocation size of one chunk
+    size_t chunkAlignment{ 0 };             ///< Allocation alignment of one chunk
+    size_t count{ 0 };                      ///< Rows in use
+
+public:
+    /**
+     * @brief Constructs an empty archetype and computes its chunk layout.
+     * @param signature Table component signature of the archetype.
+     * @param registry Operations of every registered component type, by ComponentId.
+     * @param memory Memory resource the chunks are allocated from.
+     */
+    Archetype(const ComponentMask& signature, const std::array<const ComponentTypeInfo*, MaxComponents>& registry,
+        std::pmr::memory_resource* memory)
+        : mask(signature), resource(memory), chunks(memory) {
+        columnIndex.fill(-1);
+        chunkAlignment = std::max(alignof(std::max_align_t), alignof(EntityId));
+        size_t rowBytes = sizeof(EntityId);
+        for (ComponentId type = 0; type < MaxComponents; ++type) {
+            if (!mask.test(type) || tagComponents.test(type)) continue;
+
+            columnIndex[type] = static_cast<int>(types.size());
+            types.push_back(type);
+            columnTypes.push_back(registry[type]);
+            rowBytes += registry[type]->size + sizeof(Tick);
+            chunkAlignment = std::max(chunkAlignment, registry[type]->alignment);
+        }
+
+        capacity = std::max<size_t>(1, ChunkSize / rowBytes);
+        while (capacity > 1 && layout(capacity) > ChunkSize) {
+            --capacity;
+        }
+        chunkBytes = std::max(ChunkSize, layout(capacity));
+    }
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    /**
+     * @brief Destroys every stored component and returns the chunks to the memory resource.
+     */
+    ~Archetype() {
+        for (size_t column = 0; column < columnTypes.size(); ++column) {
+            if (columnTypes[column]->trivial) continue;
+
+            for (size_t row = 0; row < count; ++row) {
+                columnTypes[column]->destroy(componentAt(row, column));
+            }
+        }
+        for (std::byte* chunk : chunks) {
+            resource->deallocate(chunk, chunkBytes, chunkAlignment);
+        }
+    }
+
+    /**
+     * @brief Finds the column position for a component type.
+     * @param type The ComponentId to look for.
+     * @return Column index, or -1 if this archetype does not store the type.
+     */
+    int findColumn(ComponentId type) const {
+        return columnIndex[type];
+    }
+
+    /**
+     * @brief Retrieves the number of entities stored in this archetype.
+     * @return Row count.
+     */
+    size_t size() const { return count; }
+
+    /**
+     * @brief Retrieves how many rows fit in one chunk.
+     * @return Rows per chunk.
+     */
+    size_t getChunkCapacity() const { return capacity; }
+
+    /**
+     * @brief Retrieves the number of chunks holding at least one row.
+     * @return Chunks in use.
+     */
+    size_t chunkCount() const { return (count + capacity - 1) / capacity; }
+
+    /**
+     * @brief Retrieves the number of rows stored in a chunk.
+     * @param chunk Index of a chunk in use.
+     * @return Row count of the chunk (capacity for every chunk but the last).
+     */
+    size_t chunkRows(size_t chunk) const { return std::min(capacity, count - chunk * capacity); }
+
+    /**
+     * @brief Provides the entity IDs of a chunk.
+     * @param chunk Index of a chunk in use.
+     * @return Pointer to chunkRows(chunk) entity IDs.
+     */
+    const EntityId* chunkEntities(size_t chunk) const {
+        return reinterpret_cast<const EntityId*>(chunks[chunk] + entityOffset);
+    }
+
+    /**
+     * @brief Provides one component column of a chunk.
+     * @tparam T A component type stored by this archetype.
+     * @param chunk Index of a chunk in use.
+     * @return The chunk's components, ticks and change flag for T.
+     */
+    template<typename T>
+    ColumnSlice<T> slice(size_t chunk) {
+        int column = findColumn(componentId<T>);
+        std::byte* memory = chunks[chunk];
+        return ColumnSlice<T>{
+            reinterpret_cast<T*>(memory + dataOffsets[column]),
+            reinterpret_cast<Tick*>(memory + tickOffsets[column]),
+            reinterpret_cast<Tick*>(memory) + column };
+    }
+
+    /**
+     * @brief Retrieves the entity stored at a row.
+     * @param row Row in [0, size()).
+     * @return The owning entity.
+     */
+    EntityId getEntity(size_t row) const {
+        return chunkEntities(row / capacity)[row % capacity];
+    }
+
+    /**
+     * @brief Replaces the entity ID stored at a row, e.g. after its generation changed.
+     * @param row Row in [0, size()).
+     * @param entity The new ID.
+     */
+    void setEntity(size_t row, EntityId entity) {
+        reinterpret_cast<EntityId*>(chunks[row / capacity] + entityOffset)[row % capacity] = entity;
+    }
+
+    /**
+     * @brief Retrieves a component stored at a row.
+     * @tparam T The component type to retrieve.
+     * @param row Row in [0, size()).
+     * @return Pointer to the component, or nullptr if the archetype does not store T.
+     * @note Writes through this pointer are not recorded as changes; see markChanged().
+     */
+    template<typename T>
+    T* get(size_t row) {
+        int column = findColumn(componentId<T>);
+        return column >= 0 ? static_cast<T*>(componentAt(row, column)) : nullptr;
+    }
+
+    /**
+     * @brief Read-only overload of get().
+     */
+    template<typename T>
+    const T* get(size_t row) const {
+        return const_cast<Archetype*>(this)->get<T>(row);
+    }
+
+    /**
+     * @brief Retrieves the tick of the last change to a component.
+     * @tparam T A component type stored by this archetype.
+     * @param row Row in [0, size()).
+     * @return Tick of the last change.
+     */
+    template<typename T>
+    Tick getChangeTick(size_t row) const {
+        return tickAt(row, findColumn(componentId<T>));
+    }
+
+    /**
+     * @brief Records a change to a component.
+     * @tparam T A component type stored by this archetype.
+     * @param row Row in [0, size()).
+     * @param tick The World's current change tick.
+     */
+    template<typename T>
+    void markChanged(size_t row, Tick tick) {
+        slice<T>(row / capacity).markChanged(row % capacity, tick);
+    }
+
+    /**
+     * @brief Constructs a component in a row whose slot for T is uninitialized.
+     * @tparam T A component type stored by this archetype.
+     * @tparam Args Constructor argument types.
+     * @param row Row returned by appendRow() that has not received T yet.
+     * @param tick Change tick of the new component.
+     * @param args Forwarded arguments to the component's constructor.
+     */
+    template<typename T, typename... Args>
+    void emplace(size_t row, Tick tick, Args&&... args) {
+        ColumnSlice<T> column = slice<T>(row / capacity);
+        new (column.data + row % capacity) T(std::forward<Args>(args)...);
+        column.markChanged(row % capacity, tick);
+    }
+
+    /**
+     * @brief Copy-constructs a component into a range of rows whose slots for T are uninitialized.
+     * @tparam T A component type stored by this archetype.
+     * @param first First row of the range.
+     * @param rows Number of rows in the range.
+     * @param value Component copied into every row.
+     * @param tick Change tick of the new components.
+     * @details Fills chunk by chunk, so each call to the standard algorithms covers one contiguous array.
+     */
+    template<typename T>
+    void fill(size_t first, size_t rows, const T& value, Tick tick) {
+        size_t end = first + rows;
+        while (first < end) {
+            size_t offset = first % capacity;
+            size_t span = std::min(capacity - offset, end - first);
+            ColumnSlice<T> column = slice<T>(first / capacity);
+            std::uninitialized_fill_n(column.data + offset, span, value);
+            std::fill_n(column.ticks + offset, span, tick);
+            if (tick > *column.lastChanged) *column.lastChanged = tick;
+            first += span;
+        }
+    }
+
+    /**
+     * @brief Appends a row for an entity, allocating a chunk if the last one is full.
+     * @param entity The entity owning the new row.
+     * @return The new row. Its component slots are uninitialized and must be constructed by the caller.
+     */
+    size_t appendRow(EntityId entity) {
+        if (count == chunks.size() * capacity) {
+            addChunk();
+        }
+        size_t row = count++;
+        setEntity(row, entity);
+        return row;
+    }
+
+    /**
+     * @brief Allocates chunks in advance so that rows can be appended without allocating.
+     * @param rows Total number of rows to make room for.
+     */
+    void reserve(size_t rows) {
+        while (chunks.size() * capacity < rows) {
+            addChunk();
+        }
+    }
+
+    /**
+     * @brief Move-constructs the components of a row into a row of another archetype.
+     * @param row Source row. Its components are left in a moved-from state.
+     * @param destination Archetype receiving the components.
+     * @param destinationRow Row of destination whose slots are uninitialized.
+     * @details Only the component types stored by both archetypes are moved, along with their change ticks.
+     *          Trivially copyable components are copied bytewise.
+     */
+    void moveRowTo(size_t row, Archetype& destination, size_t destinationRow) {
+        for (size_t column = 0; column < types.size(); ++column) {
+            int target = destination.findColumn(types[column]);
+            if (target < 0) continue;
+
+            const ComponentTypeInfo& type = *columnTypes[column];
+            if (type.trivial) {
+                std::memcpy(destination.componentAt(destinationRow, target), componentAt(row, column), type.size);
+            }
+            else {
+                type.moveConstruct(destination.componentAt(destinationRow, target), componentAt(row, column));
+            }
+            destination.touch(destinationRow, target, tickAt(row, column));
+        }
+    }
+
+    /**
+     * @brief Removes a row, filling the hole with the archetype's last row.
+     * @param row The row to remove. Its components are destroyed.
+     * @return The entity moved into row, or a null handle if row was the last one.
+     */
+    EntityId removeRow(size_t row) {
+        size_t last = count - 1;
+        for (size_t column = 0; column < columnTypes.size(); ++column) {
+            const ComponentTypeInfo& type = *columnTypes[column];
+            void* hole = componentAt(row, column);
+            if (type.trivial) {
+                if (row != last) std::memcpy(hole, componentAt(last, column), type.size);
+            }
+            else {
+                type.destroy(hole);
+                if (row != last) {
+                    type.moveConstruct(hole, componentAt(last, column));
+                    type.destroy(componentAt(last, column));
+                }
+            }
+            if (row != last) {
+                touch(row, column, tickAt(last, column));
+            }
+        }
+
+        EntityId moved;
+        if (row != last) {
+            moved = getEntity(last);
+            setEntity(row, moved);
+        }
+        --count;
+        return moved;
+    }
+
+private:
+    /**
+     * @brief Computes the chunk layout for a row capacity.
+     * @param rows Rows per chunk.
+     * @return Bytes needed by one chunk.
+     */
+    size_t layout(size_t rows) {
+        auto alignUp = [](size_t offset, size_t alignment) { return (offset + alignment - 1) / alignment * alignment; };
+
+        size_t offset = columnTypes.size() * sizeof(Tick);
+        entityOffset = alignUp(offset, alignof(EntityId));
+        offset = entityOffset + rows * sizeof(EntityId);
+
+        dataOffsets.assign(columnTypes.size(), 0);
+        tickOffsets.assign(columnTypes.size(), 0);
+        for (size_t column = 0; column < columnTypes.size(); ++column) {
+            dataOffsets[column] = alignUp(offset, columnTypes[column]->alignment);
+            offset = dataOffsets[column] + rows * columnTypes[column]->size;
+        }
+        for (size_t column = 0; column < columnTypes.size(); ++column) {
+            tickOffsets[column] = alignUp(offset, alignof(Tick));
+            offset = tickOffsets[column] + rows * sizeof(Tick);
+        }
+        return offset;
+    }
+
+    /**
+     * @brief Allocates one chunk and clears its column change flags.
+     */
+    void addChunk() {
+        auto* chunk = static_cast<std::byte*>(resource->allocate(chunkBytes, chunkAlignment));
+        std::fill_n(reinterpret_cast<Tick*>(chunk), columnTypes.size(), Tick{ 0 });
+        chunks.push_back(chunk);
+    }
+
+    /**
+     * @brief Locates the component of a column at a row.
+     */
+    void* componentAt(size_t row, size_t column) {
+        return chunks[row / capacity] + dataOffsets[column] + (row % capacity) * columnTypes[column]->size;
+    }
+
+    /**
+     * @brief Reads the change tick of a column at a row.
+     */
+    Tick tickAt(size_t row, size_t column) const {
+        return reinterpret_cast<const Tick*>(chunks[row / capacity] + tickOffsets[column])[row % capacity];
+    }
+
+    /**
+     * @brief Writes the change tick of a column at a row and raises the chunk's change flag.
+     */
+    void touch(size_t row, size_t column, Tick tick) {
+        std::byte* chunk = chunks[row / capacity];
+        reinterpret_cast<Tick*>(chunk + tickOffsets[column])[row % capacity] = tick;
+        Tick& flag = reinterpret_cast<Tick*>(chunk)[column];
+        if (tick > flag) flag = tick;
+    }
+};
+
+/**
+ * @brief Dense index identifying a resource type within every World.
+ */
+using ResourceId = uint32_t;
+
+/**
+ * @brief Hands out the next unused ResourceId.
+ */
+inline ResourceId nextResourceId() {
+    static ResourceId next = 0;
+    return next++;
+}
+
+/**
+ * @brief ResourceId of T, assigned once per type without RTTI.
+ * @details Unlike components, resources need no registration list: any type can be stored, and the World
+ *          looks it up by indexing an array with this ID.
+ */
+template<typename T>
+inline const ResourceId resourceId = nextResourceId();
+
+/**
+ * @brief Type-erased owner of one resource, letting the World destroy resources without knowing their types.
+ */
+struct IResource {
+    virtual ~IResource() = default;
+};
+
+/**
+ * @brief Concrete owner of a resource of type T.
+ */
+template<typename T>
+struct Resource : IResource {
+    T value;    ///< The stored resource
+
+    template<typename... Args>
+    explicit Resource(Args&&... args) : value(std::forward<Args>(args)...) {}
+};
+
+template<typename... Ts>
+class View;
+
+template<typename... Ts>
+class Query;
+
+class Prefab;
+
+/**
+ * @brief Owner of all entities and their components, grouped by archetype.
+ * @details Entities are generational EntityId handles. Each slot records which archetype the entity belongs
+ *          to and which row it occupies. Adding or removing a table component moves the entity's row to the
+ *          matching archetype, while sparse-set components are inserted into or removed from their pool
+ *          without moving anything. Destroyed slots are reused with a bumped generation, and every access
+ *          through a stale handle is rejected.
+ * @warning Structural changes (add/remove/destroy) may invalidate component pointers of other entities
+ *          stored in the same archetypes, since the last row of an archetype moves into a vacated row.
+ */
+class World {
+private:
+    /**
+     * @brief Location and liveness of an entity slot.
+     */
+    struct EntityRecord {
+        Archetype* archetype{ nullptr };    ///< Archetype holding the entity's components (nullptr if dead)
+        size_t row{ 0 };                    ///< Row within the archetype's columns
+        uint32_t generation{ 0 };           ///< Current generation of this slot
+        ComponentMask mask;                 ///< Every component the entity owns, table and sparse-set
+    };
+
+    std::pmr::unsynchronized_pool_resource arena;                   ///< Backs all component and row storage
+    std::vector<EntityRecord> records;                              ///< Entity slots, by index
+    std::vector<EntityIndex> freeIndices;                           ///< Slots of destroyed entities ready for reuse
+    std::vector<Scope<Archetype>> archetypes;                       ///< Owned archetypes (stable addresses)
+    std::map<ComponentMask, Archetype*> archetypeLookup;                ///< Signature to archetype lookup
+    std::array<const ComponentTypeInfo*, MaxComponents> componentTypes{}; ///< Type information per known table type
+    std::array<Scope<IComponentPool>, MaxComponents> pools;             ///< Sparse-set pools by ComponentId
+    std::vector<Scope<IResource>> resources;                        ///< Singleton resources by ResourceId
+    std::array<std::vector<Scope<Observer>>, MaxComponents> observers;  ///< Observers by observed ComponentId
+    std::array<ComponentEvent, MaxComponents> observedEvents{};         ///< Union of the events observed per type
+    Tick changeTick{ 1 };                                           ///< Tick stamped on components changed now
+    uint32_t archetypeGeneration{ 0 };                              ///< Bumped whenever reset() drops the archetypes
+
+public:
+    /**
+     * @brief Constructs an empty world.
+     * @param upstream Resource the arena obtains its large blocks from.
+     */
+    explicit World(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : arena(std::pmr::pool_options{ 0, ChunkSize }, upstream) {
+        getOrCreateArchetype(ComponentMask{});
+    }
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    /**
+     * @brief Creates a new entity with no components.
+     * @return Generational handle identifying the new entity.
+     * @details Reuses the slot of a destroyed entity when one is available.
+     */
+    EntityId createEntity() {
+        EntityIndex index = allocateIndex();
+        EntityId id{ index, records[index].generation };
+        placeEntity(id);
+        return id;
+    }
+
+    /**
+     * @brief Takes an entity slot without creating the entity yet.
+     * @return Handle the entity will have once createReservedEntity() is called with it.
+     * @details Touches no archetype, so it is safe while storage is being iterated. Until it is created the
+     *          handle is not alive: component operations on it are ignored. A reservation that will never be
+     *          created must be handed back with releaseReservedEntity(), or its slot is not reused.
+     */
+    EntityId reserveEntity() {
+        EntityIndex index = allocateIndex();
+        return EntityId{ index, records[index].generation };
+    }
+
+    /**
+     * @brief Creates the empty entity behind a handle returned by reserveEntity().
+     * @param entity The reserved handle.
+     * @return True if the entity was created; false if the handle was already created, released or reset.
+     */
+    bool createReservedEntity(EntityId entity) {
+        if (!isReserved(entity)) return false;
+        placeEntity(entity);
+        return true;
+    }
+
+    /**
+     * @brief Returns a reserved slot that will not be created to the free list.
+     * @param entity The reserved handle; ignored if it was already created, released or reset.
+     */
+    void releaseReservedEntity(EntityId entity) {
+        if (!isReserved(entity)) return;
+        ++records[entity.index].generation;
+        freeIndices.push_back(entity.index);
+    }
+
+    /**
+     * @brief Destroys an entity and all of its components.
+     * @param entity The entity to destroy.
+     * @details Bumps the slot's generation so every outstanding handle to the entity becomes stale.
+     *          Destroying a stale handle does nothing.
+     */
+    void destroyEntity(EntityId entity) {
+        if (!isAlive(entity)) return;
+
+        EntityRecord& record = records[entity.index];
+        notifyRemoved(entity, record.mask);
+        removeRow(record.archetype, record.row);
+        for (auto& pool : pools) {
+            if (pool) pool->remove(entity.index);
+        }
+
+        record.archetype = nullptr;
+        record.mask = ComponentMask{};
+        ++record.generation;
+        freeIndices.push_back(entity.index);
+    }
+
+    /**
+     * @brief Destroys every entity and releases all component storage in one step.
+     * @details Archetypes and pools are dropped and the arena hands its blocks back at once, instead of
+     *          freeing components one by one. Entity slots are kept with bumped generations, so handles
+     *          from before the reset (reserved ones included) are detected as stale and the slots are reused
+     *          by later entities.
+     *          Resources are not entities and survive the reset. Observers are kept with their pending
+     *          batches dropped, and the removals caused by the reset are not reported.
+     */
+    void reset() {
+        for (auto& typeObservers : observers) {
+            for (auto& observer : typeObservers) {
+                observer->clear();
+            }
+        }
+
+        archetypeLookup.clear();
+        archetypes.clear();
+        ++archetypeGeneration;
+        for (auto& pool : pools) {
+            pool.reset();
+        }
+        arena.release();
+
+        freeIndices.clear();
+        for (EntityIndex index = static_cast<EntityIndex>(records.size()); index-- > 0;) {
+            EntityRecord& record = records[index];
+            record = { nullptr, 0, record.generation + 1, ComponentMask{} };
+            freeIndices.push_back(index);
+        }
+
+        getOrCreateArchetype(ComponentMask{});
+    }
+
+    /**
+     * @brief Checks if a handle refers to a live entity of this world.
+     * @param entity The handle to validate.
+     * @return False for null handles and for handles whose entity has been destroyed.
+     */
+    bool isAlive(EntityId entity) const {
+        return entity.index < records.size() &&
+            records[entity.index].generation == entity.generation &&
+            records[entity.index].archetype != nullptr;
+    }
+
+    /**
+     * @brief Adds a component to an entity in the storage selected by ComponentStorage<T>.
+     * @tparam T The component type to add.
+     * @tparam Args Constructor argument types.
+     * @param entity The entity receiving the component.
+     * @param args Forwarded arguments to the component's constructor (ignored for tags).
+     * @note Overwrites the existing component of the same type if present. Ignored for stale handles.
+     */
+    template<typename T, typename... Args>
+    void addComponent(EntityId entity, Args&&... args) {
+        if (!isAlive(entity)) return;
+
+        bool existed = records[entity.index].mask.test(componentId<T>);
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            auto& pool = getPool<T>();
+            pool.emplace(entity, std::forward<Args>(args)...);
+            pool.markChanged(entity.index, changeTick);
+        }
+        else if constexpr (ComponentStorage<T>::type == StorageType::Tag) {
+            addTagComponent(entity.index, componentId<T>);
+        }
+        else {
+            addTableComponent<T>(entity.index, std::forward<Args>(args)...);
+        }
+        records[entity.index].mask.set(componentId<T>);
+
+        if (!existed) {
+            notify(componentId<T>, ComponentEvent::Added, entity);
+        }
+        else if constexpr (ComponentStorage<T>::type != StorageType::Tag) {
+            notify(componentId<T>, ComponentEvent::Changed, entity);
+        }
+    }
+
+    /**
+     * @brief Removes a component from an entity.
+     * @tparam T The component type to remove.
+     * @param entity The entity losing the component.
+     * @details Table and tag components move the entity to the archetype without T; sparse-set components
+     *          are swap-and-popped out of their pool.
+     */
+    template<typename T>
+    void removeComponent(EntityId entity) {
+        if (!hasComponent<T>(entity)) return;
+
+        EntityRecord& record = records[entity.index];
+
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            getPool<T>().remove(entity.index);
+        }
+        else {
+            ComponentMask mask = record.archetype->mask;
+            mask.reset(componentId<T>);
+            moveEntity(entity.index, getOrCreateArchetype(mask));
+        }
+        record.mask.reset(componentId<T>);
+        notify(componentId<T>, ComponentEvent::Removed, entity);
+    }
+
+    /**
+     * @brief Retrieves a component of an entity for modification.
+     * @tparam T The component type to retrieve.
+     * @param entity The entity to query.
+     * @return Pointer into the archetype column or pool, or nullptr if the entity lacks T or is stale.
+     * @details Mutable access counts as a change: the component is stamped with the current change tick and
+     *          reported to Changed observers. Use readComponent() to inspect a component without marking it.
+     */
+    template<typename T>
+    T* getComponent(EntityId entity) {
+        static_assert(ComponentStorage<T>::type != StorageType::Tag, "Tags carry no data; use hasComponent");
+        if (!hasComponent<T>(entity)) return nullptr;
+
+        notify(componentId<T>, ComponentEvent::Changed, entity);
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            auto& pool = getPool<T>();
+            pool.markChanged(entity.index, changeTick);
+            return pool.get(entity.index);
+        }
+        else {
+            const EntityRecord& record = records[entity.index];
+            record.archetype->markChanged<T>(record.row, changeTick);
+            return record.archetype->get<T>(record.row);
+        }
+    }
+
+    /**
+     * @brief Retrieves a component of an entity without recording a change.
+     * @tparam T The component type to retrieve.
+     * @param entity The entity to query.
+     * @return Read-only pointer to the component, or nullptr if the entity lacks T or is stale.
+     */
+    template<typename T>
+    const T* readComponent(EntityId entity) const {
+        return getComponent<T>(entity);
+    }
+
+    /**
+     * @brief Read-only overload of getComponent(). Does not record a change.
+     */
+    template<typename T>
+    const T* getComponent(EntityId entity) const {
+        static_assert(ComponentStorage<T>::type != StorageType::Tag, "Tags carry no data; use hasComponent");
+        if (!isAlive(entity)) return nullptr;
+
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            const auto& pool = pools[componentId<T>];
+            return pool ? static_cast<const ComponentPool<T>&>(*pool).get(entity.index) : nullptr;
+        }
+        else {
+            const EntityRecord& record = records[entity.index];
+            return std::as_const(*record.archetype).get<T>(record.row);
+        }
+    }
+
+    /**
+     * @brief Checks if an entity's component changed after a given tick.
+     * @tparam T The component type to check.
+     * @param entity The entity to query.
+     * @param since Tick the caller last observed, usually a value returned by advanceChangeTick().
+     * @return True if the entity owns T and T was added or mutably accessed after since.
+     */
+    template<typename T>
+    bool isChanged(EntityId entity, Tick since) const {
+        static_assert(ComponentStorage<T>::type != StorageType::Tag, "Tags carry no data to change");
+        if (!hasComponent<T>(entity)) return false;
+
+        if constexpr (ComponentStorage<T>::type == StorageType::SparseSet) {
+            return static_cast<const ComponentPool<T>&>(*pools[componentId<T>]).getChangeTick(entity.index) > since;
+        }
+        else {
+            const EntityRecord& record = records[entity.index];
+            return record.archetype->getChangeTick<T>(record.row) > since;
+        }
+    }
+
+    /**
+     * @brief Retrieves the tick stamped on components changed right now.
+     * @return The current change tick.
+     */
+    Tick getChangeTick() const { return changeTick; }
+
+    /**
+     * @brief Closes the current change tick and starts a new one.
+     * @return The tick that was just closed. Every change made so far is stamped at or before it, and every
+     *         later change is stamped after it, so it is the value to pass as since on the next query.
+     * @example
+     * @code
+     * Tick lastSeen = 0;
+     * world.view<const CombatState>().eachChanged<const CombatState>(lastSeen, redraw);
+     * lastSeen = world.advanceChangeTick();
+     * @endcode
+     */
+    Tick advanceChangeTick() { return changeTick++; }
+
+    /**
+     * @brief Registers an observer collecting the entities affected by events on component T.
+     * @tparam T The observed component type (tags included).
+     * @param events One or more ComponentEvent flags, e.g. ComponentEvent::Added | ComponentEvent::Removed.
+     * @return Reference to the observer, owned by the world and valid for its lifetime.
+     * @details Events are queued, not dispatched: the owning system drains the observer once per pass.
+     * @example
+     * @code
+     * Observer& defeats = world.observe<Alive>(ComponentEvent::Removed);
+     * // ... once per pass:
+     * defeats.drain([&](EntityId entity) { ... });
+     * @endcode
+     */
+    template<typename T>
+    Observer& observe(ComponentEvent events) {
+        ComponentId type = componentId<std::remove_const_t<T>>;
+        observedEvents[type] = observedEvents[type] | events;
+        return *observers[type].emplace_back(std::make_unique<Observer>(type, events));
+    }
+
+    /**
+     * @brief Checks if any observer listens to an event on a component type.
+     * @param type The component type's ID.
+     * @param event The event to test.
+     * @return True if notify() for this type and event would queue anything.
+     */
+    bool isObserved(ComponentId type, ComponentEvent event) const {
+        return hasEvent(observedEvents[type], event);
+    }
+
+    /**
+     * @brief Queues an entity in every observer of an event on a component type.
+     * @param type The component type's ID.
+     * @param event The event that happened.
+     * @param entity The affected entity.
+     * @details Called by the world's own structural and mutable-access paths; views and batch spawning call
+     *          it for the writes they perform directly on storage.
+     */
+    void notify(ComponentId type, ComponentEvent event, EntityId entity) {
+        if (!isObserved(type, event)) return;
+
+        for (auto& observer : observers[type]) {
+            if (hasEvent(observer->getEvents(), event)) {
+                observer->push(entity);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks if an entity owns a component type.
+     * @tparam T The component type to check.
+     * @param entity The entity to query.
+     * @return True if the entity is alive and owns T.
+     * @details A single bit test on the entity's component mask, regardless of storage backend.
+     */
+    template<typename T>
+    bool hasComponent(EntityId entity) const {
+        return isAlive(entity) && records[entity.index].mask.test(componentId<T>);
+    }
+
+    /**
+     * @brief Retrieves the signature of every component an entity owns.
+     * @param entity The entity to query.
+     * @return The entity's component mask, or an empty mask for stale handles.
+     */
+    ComponentMask getMask(EntityId entity) const {
+        return isAlive(entity) ? records[entity.index].mask : ComponentMask{};
+    }
+
+    /**
+     * @brief Checks if an entity owns every component in a signature.
+     * @param entity The entity to query.
+     * @param required Signature to test, e.g. componentMask<CombatState, DisplayInfo>.
+     * @return True if the entity is alive and its mask contains required.
+     */
+    bool matches(EntityId entity, const ComponentMask& required) const {
+        return isAlive(entity) && records[entity.index].mask.containsAll(required);
+    }
+
+    /**
+     * @brief Removes every component from an entity, moving it back to the empty archetype.
+     * @param entity The entity to clear.
+     */
+    void clearComponents(EntityId entity) {
+        if (!isAlive(entity)) return;
+
+        notifyRemoved(entity, records[entity.index].mask);
+        moveEntity(entity.index, archetypes.front().get());
+        for (auto& pool : pools) {
+            if (pool) pool->remove(entity.index);
+        }
+        records[entity.index].mask = ComponentMask{};
+    }
+
+    /**
+     * @brief Strips an entity for reuse while keeping its slot out of the free list.
+     * @param entity The entity to recycle.
+     * @return Handle to the emptied slot under a new generation, or a null handle if entity is stale.
+     * @details Used by EntityPool: the components are released as in clearComponents(), and outstanding
+     *          handles to the old entity become stale, but the slot stays alive in the empty archetype
+     *          until the pool hands it out again.
+     */
+    EntityId recycleEntity(EntityId entity) {
+        if (!isAlive(entity)) return EntityId{};
+
+        clearComponents(entity);
+        EntityRecord& record = records[entity.index];
+        EntityId renewed{ entity.index, ++record.generation };
+        record.archetype->setEntity(record.row, renewed);
+        return renewed;
+    }
+
+    /**
+     * @brief Checks if an entity has no components.
+     * @param entity The entity to query.
+     * @return True if the entity's component mask is empty (or the handle is stale).
+     */
+    bool isEmpty(EntityId entity) const {
+        return !isAlive(entity) || records[entity.index].mask.none();
+    }
+
+    /**
+     * @brief Retrieves the sparse-set pool of a component type, creating it on first use.
+     * @tparam T A component type whose ComponentStorage is SparseSet.
+     * @return Reference to the pool, whose dense array can be iterated directly by systems.
+     */
+    template<typename T>
+    ComponentPool<T>& getPool() {
+        static_assert(ComponentStorage<T>::type == StorageType::SparseSet,
+            "getPool requires a component stored as StorageType::SparseSet");
+        auto& pool = pools[componentId<T>];
+        if (!pool) {
+            pool = std::make_unique<ComponentPool<T>>(&arena);
+        }
+        return static_cast<ComponentPool<T>&>(*pool);
+    }
+
+    /**
+     * @brief Retrieves the sparse-set pool of a component type without creating it.
+     * @tparam T A component type whose ComponentStorage is SparseSet.
+     * @return Pointer to the pool, or nullptr if no component of type T was ever added.
+     */
+    template<typename T>
+    ComponentPool<T>* findPool() {
+        return static_cast<ComponentPool<T>*>(pools[componentId<T>].get());
+    }
+
+    /**
+     * @brief Creates a query over every entity owning all of the requested components.
+     * @tparam Ts Component types to match; const-qualified types are passed to callbacks as const.
+     * @return Lightweight view that iterates packed storage without allocating.
+     * @example
+     * @code
+     * world.view<CombatState, const DisplayInfo>().each(
+     *     [](EntityId id, CombatState& state, const DisplayInfo& display) { ... });
+     * @endcode
+     */
+    template<typename... Ts>
+    View<Ts...> view();
+
+    /**
+     * @brief Read-only overload of view(). Every requested component type must be const-qualified.
+     */
+    template<typename... Ts>
+    View<Ts...> view() const;
+
+    /**
+     * @brief Creates a persistent query that caches the archetypes matching the requested components.
+     * @tparam Ts Component types to match; const-qualified types are passed to callbacks as const.
+     * @return Query to keep and iterate repeatedly; see Query.h.
+     */
+    template<typename... Ts>
+    Query<Ts...> query();
+
+    /**
+     * @brief Makes a table component type known to the world so archetypes can hold columns of it.
+     * @tparam T A component type whose ComponentStorage is Table.
+     * @details Called automatically the first time T is added; idempotent.
+     */
+    template<typename T>
+    void registerColumn() {
+        componentTypes[componentId<T>] = &componentTypeInfo<T>;
+    }
+
+    /**
+     * @brief Creates count entities sharing a prefab's component layout in one operation.
+     * @param prefab Component values every new entity starts with.
+     * @param count Number of entities to spawn.
+     * @return Handles of the new entities, in row order.
+     * @details Finds the target archetype once, allocates every chunk the batch needs and reserves the
+     *          sparse-set pools once, then bulk-fills each column with copies of the prefab's values.
+     */
+    std::vector<EntityId> spawnBatch(const Prefab& prefab, size_t count);
+
+    /**
+     * @brief Stores the world's single instance of resource type T.
+     * @tparam T Resource type; any movable type can be used without registration.
+     * @tparam Args Constructor argument types.
+     * @param args Forwarded arguments to T's constructor.
+     * @return Reference to the stored resource.
+     * @details If the resource already exists, the new value is assigned into it, so references obtained
+     *          earlier remain valid. Resources that cannot be assigned (e.g. a JobSystem) are replaced.
+     * @example
+     * @code
+     * world.insertResource<TurnCounter>();
+     * world.getResource<TurnCounter>()->turn++;
+     * @endcode
+     */
+    template<typename T, typename... Args>
+    T& insertResource(Args&&... args) {
+        ResourceId id = resourceId<T>;
+        if (id >= resources.size()) {
+            resources.resize(id + 1);
+        }
+
+        auto& slot = resources[id];
+        if constexpr (std::is_move_assignable_v<T>) {
+            if (slot) {
+                T& existing = static_cast<Resource<T>&>(*slot).value;
+                existing = T(std::forward<Args>(args)...);
+                return existing;
+            }
+        }
+        slot = std::make_unique<Resource<T>>(std::forward<Args>(args)...);
+        return static_cast<Resource<T>&>(*slot).value;
+    }
+
+    /**
+     * @brief Retrieves the world's resource of type T.
+     * @tparam T The resource type.
+     * @return Pointer to the resource, or nullptr if none was inserted.
+     */
+    template<typename T>
+    T* getResource() {
+        ResourceId id = resourceId<T>;
+        if (id >= resources.size() || !resources[id]) return nullptr;
+        return &static_cast<Resource<T>&>(*resources[id]).value;
+    }
+
+    /**
+     * @brief Read-only overload of getResource().
+     */
+    template<typename T>
+    const T* getResource() const {
+        return const_cast<World*>(this)->getResource<T>();
+    }
+
+    /**
+     * @brief Checks if the world stores a resource of type T.
+     */
+    template<typename T>
+    bool hasResource() const {
+        return getResource<T>() != nullptr;
+    }
+
+    /**
+     * @brief Destroys the world's resource of type T, if any.
+     * @warning Invalidates every reference to the resource.
+     */
+    template<typename T>
+    void removeResource() {
+        ResourceId id = resourceId<T>;
+        if (id < resources.size()) {
+            resources[id].reset();
+        }
+    }
+
+    /**
+     * @brief Provides access to every archetype for linear iteration by systems.
+     * @return Constant reference to the owned archetypes.
+     */
+    const std::vector<Scope<Archetype>>& getArchetypes() const { return archetypes; }
+
+    /**
+     * @brief Retrieves a counter bumped every time reset() drops the archetypes.
+     * @details Archetypes are otherwise only ever appended to getArchetypes(), so a cache of matching
+     *          archetypes stays valid as long as this value is unchanged and only needs to test the new ones.
+     */
+    uint32_t getArchetypeGeneration() const { return archetypeGeneration; }
+
+private:
+    /**
+     * @brief Takes a free entity slot, or appends a new one.
+     * @return Index of a slot with no live entity.
+     */
+    EntityIndex allocateIndex() {
+        if (!freeIndices.empty()) {
+            EntityIndex index = freeIndices.back();
+            freeIndices.pop_back();
+            return index;
+        }
+
+        records.emplace_back();
+        return static_cast<EntityIndex>(records.size() - 1);
+    }
+
+    /**
+     * @brief Checks if a handle refers to a slot taken by reserveEntity() whose entity was not created yet.
+     */
+    bool isReserved(EntityId entity) const {
+        return entity.index < records.size() &&
+            records[entity.index].generation == entity.generation &&
+            records[entity.index].archetype == nullptr;
+    }
+
+    /**
+     * @brief Puts a new entity with no components into the empty archetype.
+     * @param entity Handle of an allocated slot with no live entity.
+     */
+    void placeEntity(EntityId entity) {
+        Archetype* empty = archetypes.front().get();
+        records[entity.index].archetype = empty;
+        records[entity.index].row = empty->appendRow(entity);
+    }
+
+    /**
+     * @brief Adds a table component, moving the entity to the archetype that includes T.
+     * @tparam T The component type to add.
+     * @tparam Args Constructor argument types.
+     * @param entity Slot of the entity receiving the component.
+     * @param args Forwarded arguments to the component's constructor.
+     */
+    template<typename T, typename... Args>
+    void addTableComponent(EntityIndex entity, Args&&... args) {
+        EntityRecord& record = records[entity];
+        constexpr ComponentId type = componentId<T>;
+
+        if (T* existing = record.archetype->get<T>(record.row)) {
+            *existing = T(std::forward<Args>(args)...);
+            record.archetype->markChanged<T>(record.row, changeTick);
+            return;
+        }
+
+        ComponentMask mask = record.archetype->mask;
+        mask.set(type);
+
+        registerColumn<T>();
+        Archetype* destination = getOrCreateArchetype(mask);
+        moveEntity(entity, destination);
+        destination->emplace<T>(record.row, changeTick, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Reports the removal of every observed component an entity still owns.
+     * @param entity The entity about to lose its components.
+     * @param mask The entity's current component mask.
+     */
+    void notifyRemoved(EntityId entity, const ComponentMask& mask) {
+        for (ComponentId type = 0; type < MaxComponents; ++type) {
+            if (mask.test(type) && isObserved(type, ComponentEvent::Removed)) {
+                notify(type, ComponentEvent::Removed, entity);
+            }
+        }
+    }
+
+    /**
+     * @brief Adds a tag, moving the entity to the archetype that includes it.
+     * @param entity Slot of the entity receiving the tag.
+     * @param type ComponentId of the tag.
+     */
+    void addTagComponent(EntityIndex entity, ComponentId type) {
+        EntityRecord& record = records[entity];
+        if (record.archetype->mask.test(type)) return;
+
+        ComponentMask mask = record.archetype->mask;
+        mask.set(type);
+        moveEntity(entity, getOrCreateArchetype(mask));
+    }
+
+    /**
+     * @brief Finds the archetype for a signature, creating it if needed.
+     * @param mask Table and tag signature. Every table type in it must have been registered with registerColumn().
+     * @return Archetype matching the signature.
+     */
+    Archetype* getOrCreateArchetype(const ComponentMask& mask) {
+        auto it = archetypeLookup.find(mask);
+        if (it != archetypeLookup.end()) return it->second;
+
+        auto archetype = std::make_unique<Archetype>(mask, componentTypes, &arena);
+        Archetype* result = archetype.get();
+        archetypes.push_back(std::move(archetype));
+        archetypeLookup[mask] = result;
+        return result;
+    }
+
+    /**
+     * @brief Removes a row from an archetype, filling the hole with the archetype's last row.
+     * @param archetype The archetype to remove from.
+     * @param row The row to remove.
+     * @details Updates the record of the entity whose row was moved into the hole.
+     */
+    void removeRow(Archetype* archetype, size_t row) {
+        EntityId moved = archetype->removeRow(row);
+        if (!moved.isNull()) {
+            records[moved.index].row = row;
+        }
+    }
+
+    /**
+     * @brief Moves an entity's row into another archetype, keeping only the shared components.
+     * @param entity Slot of the entity to move.
+     * @param destination Target archetype.
+     * @details The vacated source row is filled by the source archetype's last row (swap-and-pop). Slots of
+     *          destination types the source does not store are left uninitialized for the caller to construct.
+     */
+    void moveEntity(EntityIndex entity, Archetype* destination) {
+        EntityRecord& record = records[entity];
+        Archetype* source = record.archetype;
+        if (source == destination) return;
+
+        size_t row = record.row;
+        size_t destinationRow = destination->appendRow(source->getEntity(row));
+        source->moveRowTo(row, *destination, destinationRow);
+        removeRow(source, row);
+
+        record.archetype = destination;
+        record.row = destinationRow;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,112 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Bench.h
+ * @brief: Minimal benchmark harness for the ECS_MrSanmi_Bench executable.
+ * @details: Each benchmark is a function registered with BENCHMARK(name) in its own .cpp file. It times the
+ *           variants it compares with measure() and prints them with report(), so every case shows the old
+ *           and the new approach side by side. Build the Release configuration before quoting numbers.
+ */
+
+/**
+ * @brief Defines and registers a benchmark function.
+ */
+#define BENCHMARK(name) \
+    static void name(); \
+    static bench::Registrar name##Registrar(#name, name); \
+    static void name()
+
+namespace bench {
+
+/**
+ * @brief A registered benchmark.
+ */
+struct Case {
+    const char* name;   ///< Name used for filtering and in the output
+    void (*run)();      ///< Runs the benchmark and prints its results
+};
+
+/**
+ * @brief Retrieves every registered benchmark, in registration order.
+ */
+inline std::vector<Case>& registry() {
+    static std::vector<Case> cases;
+    return cases;
+}
+
+/**
+ * @brief Registers a benchmark during static initialization (used by BENCHMARK).
+ */
+struct Registrar {
+    Registrar(const char* name, void (*run)()) {
+        registry().push_back(Case{ name, run });
+    }
+};
+
+/**
+ * @brief Keeps a computed value alive so the optimizer cannot drop the work producing it.
+ * @param value Result of the measured work.
+ */
+inline void keep(int64_t value) {
+    static volatile int64_t sink = 0;
+    sink = sink + value;
+}
+
+/**
+ * @brief Times a piece of work and returns its best cost per item.
+ * @tparam Setup Callable run before every repetition, not timed.
+ * @tparam Run Callable doing the measured work.
+ * @param items Number of items (entities, pairs, casts...) one call of run processes.
+ * @param setup Prepares the state run works on.
+ * @param run The measured work.
+ * @param repetitions Number of timed repetitions after one warm-up run.
+ * @return Fastest repetition in nanoseconds per item.
+ */
+template<typename Setup, typename Run>
+double measure(size_t items, Setup&& setup, Run&& run, int repetitions = 7) {
+    setup();
+    run();
+
+    double best = 0.0;
+    for (int i = 0; i < repetitions; ++i) {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        run();
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        double perItem = elapsed.count() / static_cast<double>(std::max<size_t>(items, 1));
+        if (i == 0 || perItem < best) best = perItem;
+    }
+    return best;
+}
+
+/**
+ * @brief Times a piece of work that needs no per-repetition setup.
+ */
+template<typename Run>
+double measure(size_t items, Run&& run, int repetitions = 7) {
+    return measure(items, [] {}, std::forward<Run>(run), repetitions);
+}
+
+/**
+ * @brief Prints one measured variant.
+ * @param label Description of the variant.
+ * @param nsPerItem Result of measure().
+ * @param reference Cost of the variant it is compared to; when given, the speedup is printed too.
+ */
+inline void report(const char* label, double nsPerItem, double reference = 0.0) {
+    std::printf("  %-48s %10.2f ns/item", label, nsPerItem);
+    if (reference > 0.0) {
+        std::printf("   x%.2f", reference / nsPerItem);
+    }
+    std::printf("\n");
+}
+
+} // namespace bench
\ No newline at end of file
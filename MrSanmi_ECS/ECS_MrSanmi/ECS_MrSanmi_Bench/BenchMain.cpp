@@ -0,0 +1,24 @@
+#include "Bench.h"
+#include <cstring>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: BenchMain.cpp
+ * @brief: Entry point of the benchmark executable.
+ * @details: Runs every registered benchmark, or only those whose name contains the first argument
+ *           (e.g. "ECS_MrSanmi_Bench Spawn").
+ */
+
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+
+    for (const bench::Case& benchmark : bench::registry()) {
+        if (std::strstr(benchmark.name, filter) == nullptr) continue;
+
+        std::printf("%s\n", benchmark.name);
+        benchmark.run();
+        std::printf("\n");
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "Bench.h"
+#include "DamageKernel.h"
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: DamageBench.cpp
+ * @brief: Basic attack damage over a mass battle: AoS Stats, SoA columns and the SIMD kernels.
+ * @details: Resolves the same random attacker/target pairs from an array of Stats, from StatsColumns one
+ *           pair at a time, and with the batch kernels. The kernels use the instruction set the benchmark
+ *           is compiled for (/arch:AVX2 in the project), which is printed with the results. The one pair
+ *           at a time loops are kept from being vectorized, like resolveAttackDamageScalar().
+ */
+
+namespace {
+
+constexpr size_t Combatants = 10000;
+constexpr size_t Pairs = 100000;
+
+DAMAGE_KERNEL_SCALAR
+void resolveOneByOne(const std::vector<Stats>& stats, const std::vector<uint32_t>& attackers,
+                     const std::vector<uint32_t>& targets, std::vector<int32_t>& damage) {
+    DAMAGE_KERNEL_NO_VECTORIZE
+    for (size_t i = 0; i < damage.size(); ++i) {
+        damage[i] = attackDamage(stats[attackers[i]].attack, stats[targets[i]].defense);
+    }
+}
+
+DAMAGE_KERNEL_SCALAR
+void resolveOneByOne(const StatsColumns& stats, const std::vector<uint32_t>& attackers,
+                     const std::vector<uint32_t>& targets, std::vector<int32_t>& damage) {
+    DAMAGE_KERNEL_NO_VECTORIZE
+    for (size_t i = 0; i < damage.size(); ++i) {
+        damage[i] = attackDamage(stats.attack[attackers[i]], stats.defense[targets[i]]);
+    }
+}
+
+} // namespace
+
+BENCHMARK(AttackDamage) {
+    std::mt19937 rng(21);
+    std::vector<Stats> aos;
+    StatsColumns soa;
+    PackedStatsColumns packed;
+    for (size_t i = 0; i < Combatants; ++i) {
+        Stats stats(static_cast<int32_t>(50 + rng() % 200), static_cast<int32_t>(5 + rng() % 40),
+                    static_cast<int32_t>(rng() % 30), static_cast<int32_t>(rng() % 20), 50);
+        aos.push_back(stats);
+        soa.push_back(stats);
+        packed.push_back(stats);
+    }
+
+    std::vector<uint32_t> attackers(Pairs);
+    std::vector<uint32_t> targets(Pairs);
+    for (size_t i = 0; i < Pairs; ++i) {
+        attackers[i] = static_cast<uint32_t>(rng() % Combatants);
+        targets[i] = static_cast<uint32_t>(rng() % Combatants);
+    }
+    std::vector<int32_t> damage(Pairs);
+    std::vector<int16_t> packedDamage(Pairs);
+    std::printf(" %zu pairs over %zu combatants, kernels built for %s\n", Pairs, Combatants, damageKernelIsa());
+
+    double aosLoop = bench::measure(Pairs, [&] {
+        resolveOneByOne(aos, attackers, targets, damage);
+        bench::keep(damage[Pairs / 2]);
+    });
+    double soaLoop = bench::measure(Pairs, [&] {
+        resolveOneByOne(soa, attackers, targets, damage);
+        bench::keep(damage[Pairs / 2]);
+    });
+    double soaKernel = bench::measure(Pairs, [&] {
+        resolveAttackDamage(soa, attackers.data(), targets.data(), damage.data(), Pairs);
+        bench::keep(damage[Pairs / 2]);
+    });
+    double packedKernel = bench::measure(Pairs, [&] {
+        resolveAttackDamage(packed, attackers.data(), targets.data(), packedDamage.data(), Pairs);
+        bench::keep(packedDamage[Pairs / 2]);
+    });
+
+    bench::report("Stats array, one pair at a time", aosLoop);
+    bench::report("StatsColumns, one pair at a time", soaLoop, aosLoop);
+    bench::report((std::string("StatsColumns, resolveAttackDamage ") + damageKernelIsa()).c_str(), soaKernel, aosLoop);
+    bench::report((std::string("PackedStatsColumns, resolveAttackDamage ") + damageKernelIsa()).c_str(),
+                  packedKernel, aosLoop);
+}
+
+BENCHMARK(AttackDamagePacked) {
+    // Stats already packed side by side, as a system working on its own buffers would have them
+    std::mt19937 rng(22);
+    std::vector<int32_t> attack(Pairs);
+    std::vector<int32_t> defense(Pairs);
+    std::vector<int16_t> packedAttack(Pairs);
+    std::vector<int16_t> packedDefense(Pairs);
+    for (size_t i = 0; i < Pairs; ++i) {
+        attack[i] = packedAttack[i] = static_cast<int16_t>(5 + rng() % 40);
+        defense[i] = packedDefense[i] = static_cast<int16_t>(rng() % 30);
+    }
+    std::vector<int32_t> damage(Pairs);
+    std::vector<int16_t> packedDamage(Pairs);
+
+    double scalar = bench::measure(Pairs, [&] {
+        resolveAttackDamageScalar(attack.data(), defense.data(), damage.data(), Pairs);
+        bench::keep(damage[Pairs / 2]);
+    });
+    double kernel = bench::measure(Pairs, [&] {
+        resolveAttackDamage(attack.data(), defense.data(), damage.data(), Pairs);
+        bench::keep(damage[Pairs / 2]);
+    });
+    double packedKernel = bench::measure(Pairs, [&] {
+        resolveAttackDamage(packedAttack.data(), packedDefense.data(), packedDamage.data(), Pairs);
+        bench::keep(packedDamage[Pairs / 2]);
+    });
+
+    bench::report("resolveAttackDamageScalar, int32", scalar);
+    bench::report((std::string("resolveAttackDamage ") + damageKernelIsa() + ", int32").c_str(), kernel, scalar);
+    bench::report((std::string("resolveAttackDamage ") + damageKernelIsa() + ", int16").c_str(), packedKernel, scalar);
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "Bench.h"
+#include "Prefab.h"
+#include "View.h"
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: HotColdBench.cpp
+ * @brief: Per-turn loops over the former combined stats layout and over the hot/cold component split.
+ * @details: The two loops that touch every combatant during a battle are the AI's lowest-health scan and the
+ *           round's mana regeneration. Each is run over the former HealthComponent layout (a whole Stats per
+ *           entity), over packed CombatState/CombatBaseStats arrays, and through the World views the game
+ *           uses. The entity count is far larger than the caches, so the loops are bound by memory traffic.
+ */
+
+namespace {
+
+constexpr size_t Combatants = 1 << 20;
+
+/**
+ * @brief The former layout: every stat of an entity in one 28-byte record, as HealthComponent stored it.
+ */
+struct FormerHealthComponent {
+    Stats stats;
+};
+
+Stats combatantStats(size_t i) {
+    return Stats(static_cast<int32_t>(50 + i % 200), 20, 10, 10, static_cast<int32_t>(30 + i % 40));
+}
+
+} // namespace
+
+BENCHMARK(HotColdTurn) {
+    std::vector<FormerHealthComponent> former;
+    std::vector<CombatState> states;
+    std::vector<CombatBaseStats> bases;
+    World world;
+    for (size_t i = 0; i < Combatants; ++i) {
+        Stats stats = combatantStats(i);
+        stats.mana = static_cast<int32_t>(i % 30);
+        former.push_back({ stats });
+        states.emplace_back(stats);
+        bases.emplace_back(stats);
+
+        EntityId entity = world.createEntity();
+        world.addComponent<CombatState>(entity, stats);
+        world.addComponent<CombatBaseStats>(entity, stats);
+        world.addComponent<PlayerTeam>(entity);
+        world.addComponent<Alive>(entity);
+    }
+    std::printf(" %zu combatants: Stats %zu bytes, CombatState %zu bytes\n",
+                Combatants, sizeof(FormerHealthComponent), sizeof(CombatState));
+
+    // AI target selection: the living player with the lowest health
+    double formerScan = bench::measure(Combatants, [&] {
+        int32_t lowest = std::numeric_limits<int32_t>::max();
+        for (const FormerHealthComponent& health : former) {
+            lowest = std::min(lowest, health.stats.health);
+        }
+        bench::keep(lowest);
+    });
+    double hotScan = bench::measure(Combatants, [&] {
+        int32_t lowest = std::numeric_limits<int32_t>::max();
+        for (const CombatState& state : states) {
+            lowest = std::min(lowest, state.health);
+        }
+        bench::keep(lowest);
+    });
+    double viewScan = bench::measure(Combatants, [&] {
+        int32_t lowest = std::numeric_limits<int32_t>::max();
+        world.view<const CombatState>().with<PlayerTeam, Alive>().each([&](EntityId, const CombatState& state) {
+            lowest = std::min(lowest, state.health);
+        });
+        bench::keep(lowest);
+    });
+
+    // Round start: every combatant regenerates 5 mana up to its maximum
+    double formerRegen = bench::measure(Combatants, [&] {
+        for (FormerHealthComponent& health : former) {
+            health.stats.mana = std::min(health.stats.maxMana, health.stats.mana + 5);
+        }
+        bench::keep(former[Combatants / 2].stats.mana);
+    });
+    double hotRegen = bench::measure(Combatants, [&] {
+        for (size_t i = 0; i < Combatants; ++i) {
+            states[i].mana = std::min(bases[i].maxMana, states[i].mana + 5);
+        }
+        bench::keep(states[Combatants / 2].mana);
+    });
+    double viewRegen = bench::measure(Combatants, [&] {
+        world.view<CombatState, const CombatBaseStats>().with<Alive>().each(
+            [](EntityId, CombatState& state, const CombatBaseStats& base) {
+                state.mana = std::min(base.maxMana, state.mana + 5);
+            });
+    });
+
+    bench::report("lowest health, Stats records", formerScan);
+    bench::report("lowest health, CombatState array", hotScan, formerScan);
+    bench::report("lowest health, World view", viewScan, formerScan);
+    bench::report("mana regeneration, Stats records", formerRegen);
+    bench::report("mana regeneration, CombatState + CombatBaseStats", hotRegen, formerRegen);
+    bench::report("mana regeneration, World view", viewRegen, formerRegen);
+}
\ No newline at end of file
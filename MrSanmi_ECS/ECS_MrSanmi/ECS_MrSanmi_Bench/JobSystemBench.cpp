@@ -0,0 +1,82 @@
+#include "Bench.h"
+#include "JobSystem.h"
+#include "Graph.hpp"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: JobSystemBench.cpp
+ * @brief: JobSystem scaling with the number of workers.
+ * @details: Runs the same parallelFor and the same parallel Graph traversal at 1, 2 and 4 workers, plus the
+ *           machine's core count when it is larger. Every variant is compared with the one-worker run, so the
+ *           ratio is the speedup; on a single-core machine it can only show the scheduling overhead.
+ */
+
+namespace {
+
+std::vector<size_t> workerCounts() {
+    std::vector<size_t> counts = { 1, 2, 4 };
+    if (std::thread::hardware_concurrency() > 4) {
+        counts.push_back(std::thread::hardware_concurrency());
+    }
+    return counts;
+}
+
+} // namespace
+
+BENCHMARK(JobSystemParallelFor) {
+    constexpr size_t Count = 1 << 20;
+    std::vector<float> values(Count, 1.5f);
+    double oneWorker = 0.0;
+
+    for (size_t workers : workerCounts()) {
+        JobSystem jobs(workers);
+        double ns = bench::measure(Count, [&] {
+            jobs.parallelFor(0, Count, 4096, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    values[i] = std::sqrt(values[i] * values[i] + 1.0f);
+                }
+            });
+            bench::keep(static_cast<int64_t>(values[Count / 2]));
+        });
+
+        std::string label = std::to_string(workers) + " workers";
+        bench::report(label.c_str(), ns, oneWorker);
+        if (workers == 1) oneWorker = ns;
+    }
+}
+
+BENCHMARK(GraphTraverseBFS) {
+    constexpr int NodeCount = 3000;
+    std::mt19937 rng(7);
+    Graph<int> graph(0);
+    for (int node = 1; node < NodeCount; ++node) {
+        graph.insert(static_cast<int>(rng() % node), node);
+    }
+
+    // Printing is part of the traversal, so it goes to a discarded buffer instead of the terminal
+    std::ostringstream discarded;
+    std::streambuf* previous = std::cout.rdbuf(discarded.rdbuf());
+    auto clearOutput = [&] { discarded.str(""); };
+
+    double sequential = bench::measure(NodeCount, clearOutput, [&] { graph.traverseBFS(); }, 3);
+    std::vector<std::pair<size_t, double>> results;
+    for (size_t workers : workerCounts()) {
+        JobSystem jobs(workers);
+        results.emplace_back(workers, bench::measure(NodeCount, clearOutput, [&] { graph.traverseBFS(jobs); }, 3));
+    }
+    std::cout.rdbuf(previous);
+
+    // traverseBFS() indexes its visited list, which is a linked list, so it is not the scaling baseline
+    bench::report("traverseBFS()", sequential);
+    for (const auto& [workers, ns] : results) {
+        std::string label = "traverseBFS(jobs), " + std::to_string(workers) + " workers";
+        bench::report(label.c_str(), ns, results.front().second);
+    }
+}
\ No newline at end of file
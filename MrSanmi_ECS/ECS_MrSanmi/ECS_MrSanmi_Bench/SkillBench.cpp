@@ -0,0 +1,107 @@
+#include "Bench.h"
+#include "Skill.h"
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: SkillBench.cpp
+ * @brief: Skill casts through the effect interpreter and through equivalent lambdas.
+ * @details: Casts the same random sequence of attacks and heals between combatants twice: with the
+ *           SkillFactory bytecode skills and with lambda skills written the way the factory used to write them.
+ *           Console output is part of every cast, so it goes to a discarded buffer; health is large enough that
+ *           nobody is defeated and every cast does the same work in both variants.
+ */
+
+namespace {
+
+constexpr size_t Combatants = 2000;
+constexpr size_t Casts = 200000;
+
+Skill lambdaAttackSkill() {
+    return Skill("Basic Attack", [](Entity& user, Entity& target, CommandBuffer& commands) {
+        auto* userBase = user.readComponent<CombatBaseStats>();
+        auto* targetBase = target.readComponent<CombatBaseStats>();
+        auto* targetState = target.getComponent<CombatState>();
+        if (userBase && targetBase && targetState && target.hasComponent<Alive>()) {
+            int damage = attackDamage(userBase->attack, targetBase->defense);
+            targetState->health -= damage;
+            std::cout << "Basic attack! " << damage << " damage to "
+                << target.readComponent<DisplayInfo>()->name << ".\n";
+
+            if (targetState->health <= 0) {
+                commands.removeComponent<Alive>(target.getId());
+                commands.addComponent<Dead>(target.getId());
+            }
+        }
+        });
+}
+
+Skill lambdaHealSkill() {
+    return Skill("Heal", [](Entity& user, Entity& target, CommandBuffer&) {
+        auto* userState = user.getComponent<CombatState>();
+        auto* targetBase = target.readComponent<CombatBaseStats>();
+        auto* targetState = target.getComponent<CombatState>();
+        if (userState && targetBase && targetState && userState->mana >= 10) {
+            int heal = targetBase->maxHealth / 3;
+            int oldHealth = targetState->health;
+            targetState->health = std::min(targetBase->maxHealth, targetState->health + heal);
+            userState->mana -= 10;
+            std::cout << "Heal performed! " << targetState->health - oldHealth << " health restored to "
+                << target.readComponent<DisplayInfo>()->name << ".\n";
+        }
+        else if (userState && userState->mana < 10) {
+            std::cout << "Not enough mana to heal!\n";
+        }
+        }, 10);
+}
+
+} // namespace
+
+BENCHMARK(SkillCasts) {
+    World world;
+    CommandBuffer commands(world);
+    std::vector<EntityId> combatants;
+    for (size_t i = 0; i < Combatants; ++i) {
+        Stats stats(1000000, static_cast<int32_t>(10 + i % 20), static_cast<int32_t>(i % 15), 10, 1000000);
+        EntityId entity = world.createEntity();
+        world.addComponent<DisplayInfo>(entity, i % 2 ? "Goblin" : "Knight");
+        world.addComponent<CombatState>(entity, stats);
+        world.addComponent<CombatBaseStats>(entity, stats);
+        world.addComponent<Alive>(entity);
+        combatants.push_back(entity);
+    }
+
+    struct Cast { uint32_t user; uint32_t target; bool heal; };
+    std::mt19937 rng(25);
+    std::vector<Cast> casts(Casts);
+    for (Cast& cast : casts) {
+        cast = { static_cast<uint32_t>(rng() % Combatants), static_cast<uint32_t>(rng() % Combatants), rng() % 4 == 0 };
+    }
+
+    std::ostringstream discarded;
+    std::streambuf* previous = std::cout.rdbuf(discarded.rdbuf());
+    auto clearOutput = [&] { discarded.str(""); };
+    auto run = [&](Skill& attack, Skill& heal) {
+        for (const Cast& cast : casts) {
+            Entity user(world, combatants[cast.user]);
+            Entity target(world, combatants[cast.target]);
+            (cast.heal ? heal : attack).execute(user, target, commands);
+        }
+    };
+
+    Skill lambdaAttack = lambdaAttackSkill();
+    Skill lambdaHeal = lambdaHealSkill();
+    Skill programAttack = SkillFactory::createAttackSkill();
+    Skill programHeal = SkillFactory::createHealSkill();
+    double lambdas = bench::measure(Casts, clearOutput, [&] { run(lambdaAttack, lambdaHeal); });
+    double programs = bench::measure(Casts, clearOutput, [&] { run(programAttack, programHeal); });
+    std::cout.rdbuf(previous);
+
+    bench::keep(static_cast<int64_t>(commands.empty()));
+    bench::report("lambda skills", lambdas);
+    bench::report("Effect programs", programs, lambdas);
+}
\ No newline at end of file
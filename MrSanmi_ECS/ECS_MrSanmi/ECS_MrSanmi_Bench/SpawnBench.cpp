@@ -0,0 +1,93 @@
+#include "Bench.h"
+#include "Prefab.h"
+#include "View.h"
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: SpawnBench.cpp
+ * @brief: Spawn cost per entity and archetype iteration over a spawned wave.
+ * @details: Compares spawning a wave of identical enemies one entity at a time, the way
+ *           BattleManager::createEntity does, with World::spawnBatch from a Prefab. Then compares walking the
+ *           wave through a view, which streams the archetype's columns, with looking every entity up by handle.
+ */
+
+namespace {
+
+constexpr size_t WaveSize = 500;
+constexpr size_t LargeWaveSize = 100000;
+
+const Stats goblinStats(25, 14, 5, 10, 30);
+
+/**
+ * @brief Spawns one enemy component by component, moving it through a new archetype on every add.
+ */
+EntityId spawnEnemy(World& world) {
+    EntityId entity = world.createEntity();
+    world.addComponent<DisplayInfo>(entity, "Goblin");
+    world.addComponent<CombatState>(entity, goblinStats);
+    world.addComponent<CombatBaseStats>(entity, goblinStats);
+    world.addComponent<EnemyTeam>(entity);
+    world.addComponent<Alive>(entity);
+    return entity;
+}
+
+Prefab goblinPrefab() {
+    Prefab prefab;
+    prefab.add<DisplayInfo>("Goblin")
+          .add<CombatState>(goblinStats)
+          .add<CombatBaseStats>(goblinStats)
+          .add<EnemyTeam>()
+          .add<Alive>();
+    return prefab;
+}
+
+} // namespace
+
+BENCHMARK(SpawnWave) {
+    World world;
+    Prefab prefab = goblinPrefab();
+
+    for (size_t count : { WaveSize, LargeWaveSize }) {
+        std::printf(" %zu enemies\n", count);
+        auto reset = [&] { world.reset(); };
+
+        double single = bench::measure(count, reset, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                spawnEnemy(world);
+            }
+        });
+        double batch = bench::measure(count, reset, [&] {
+            bench::keep(static_cast<int64_t>(world.spawnBatch(prefab, count).size()));
+        });
+
+        bench::report("createEntity + addComponent per entity", single);
+        bench::report("World::spawnBatch", batch, single);
+    }
+}
+
+BENCHMARK(IterateWave) {
+    World world;
+    std::vector<EntityId> wave = world.spawnBatch(goblinPrefab(), LargeWaveSize);
+
+    double lookups = bench::measure(wave.size(), [&] {
+        int64_t total = 0;
+        for (EntityId entity : wave) {
+            const CombatState* state = world.readComponent<CombatState>(entity);
+            const CombatBaseStats* base = world.readComponent<CombatBaseStats>(entity);
+            total += state->health + base->attack;
+        }
+        bench::keep(total);
+    });
+    double view = bench::measure(wave.size(), [&] {
+        int64_t total = 0;
+        world.view<const CombatState, const CombatBaseStats>().each(
+            [&](EntityId, const CombatState& state, const CombatBaseStats& base) {
+                total += state.health + base.attack;
+            });
+        bench::keep(total);
+    });
+
+    bench::report("readComponent per handle", lookups);
+    bench::report("view<CombatState, CombatBaseStats>().each", view, lookups);
+}
\ No newline at end of file
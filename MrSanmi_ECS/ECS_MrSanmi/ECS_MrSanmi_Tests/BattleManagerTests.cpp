@@ -0,0 +1,100 @@
+#include "Test.h"
+#include "BattleManager.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: BattleManagerTests.cpp
+ * @brief: Tests of BattleManager's roster queries and target selection.
+ */
+
+namespace {
+
+/**
+ * @brief Silences std::cout for the lifetime of the object; the battle logs every step.
+ */
+struct QuietOutput {
+    std::ostringstream sink;
+    std::streambuf* previous;
+
+    QuietOutput() : previous(std::cout.rdbuf(sink.rdbuf())) {}
+    ~QuietOutput() { std::cout.rdbuf(previous); }
+};
+
+/**
+ * @brief Sets up the demo roster from Main.cpp: two heroes against three enemies.
+ */
+void addDemoRoster(BattleManager& battle) {
+    battle.addPlayer("Hero", Stats(120, 18, 8, 15, 60));
+    battle.addPlayer("Mage", Stats(90, 12, 6, 12, 40));
+    battle.addEnemy("Goblin", Stats(10, 14, 4, 10, 20));
+    battle.addEnemy("Orc", Stats(25, 20, 10, 8, 30));
+    battle.addEnemy("Goblin Boss", Stats(50, 25, 12, 6, 50));
+}
+
+std::vector<std::string> namesOf(BattleManager& battle, const std::vector<EntityId>& entities) {
+    std::vector<std::string> names;
+    for (EntityId entity : entities) {
+        names.push_back(battle.getEntity(entity).readComponent<DisplayInfo>()->name.str());
+    }
+    return names;
+}
+
+} // namespace
+
+TEST_CASE(TeamListsFollowRosterOrder) {
+    QuietOutput quiet;
+    BattleManager battle;
+    addDemoRoster(battle);
+    battle.startBattle();
+
+    using Names = std::vector<std::string>;
+    CHECK(namesOf(battle, battle.getPlayers()) == (Names{ "Hero", "Mage" }));
+    CHECK(namesOf(battle, battle.getEnemies()) == (Names{ "Goblin", "Orc", "Goblin Boss" }));
+
+    // The Hero acts first and defeats the Goblin, which moves it out of the living enemies' archetype
+    CHECK(namesOf(battle, { battle.getCurrentActor() }) == (Names{ "Hero" }));
+    battle.executePlayerAction("attack", battle.getEnemies().front());
+
+    CHECK(namesOf(battle, { battle.getCurrentActor() }) == (Names{ "Mage" }));
+    CHECK(namesOf(battle, battle.getEnemies()) == (Names{ "Orc", "Goblin Boss" }));
+    CHECK(namesOf(battle, battle.getPlayers()) == (Names{ "Hero", "Mage" }));
+    CHECK(namesOf(battle, battle.getAliveEntities()) == (Names{ "Hero", "Mage", "Orc", "Goblin Boss" }));
+}
+
+TEST_CASE(PlayerAutoTargetIsFirstLivingEnemy) {
+    QuietOutput quiet;
+    BattleManager battle;
+    addDemoRoster(battle);
+    battle.startBattle();
+
+    battle.executePlayerAction("attack", battle.getEnemies().front());
+
+    // Main.cpp attacks the first living enemy: after the Goblin falls the Mage must hit the Orc
+    EntityId orc = battle.getEnemies().front();
+    CHECK(battle.getEntity(orc).readComponent<DisplayInfo>()->name.str() == "Orc");
+
+    int healthBefore = battle.getEntity(orc).readComponent<CombatState>()->health;
+    battle.executePlayerAction("attack", orc);
+    CHECK(battle.getEntity(orc).readComponent<CombatState>()->health < healthBefore);
+}
+
+TEST_CASE(ReinforcementsJoinTheEndOfTheRoster) {
+    QuietOutput quiet;
+    BattleManager battle;
+    addDemoRoster(battle);
+    battle.startBattle();
+    battle.executePlayerAction("attack", battle.getEnemies().front());
+
+    // The defeated Goblin is released, so the Troll and the wave reuse its entity slot and the freed archetype rows
+    battle.addEnemy("Troll", Stats(60, 22, 9, 7, 0));
+    battle.addEnemies("Imp", Stats(15, 8, 2, 14, 0), 2);
+
+    using Names = std::vector<std::string>;
+    CHECK(namesOf(battle, battle.getEnemies()) == (Names{ "Orc", "Goblin Boss", "Troll", "Imp", "Imp" }));
+    CHECK(namesOf(battle, battle.getAliveEntities()) ==
+          (Names{ "Hero", "Mage", "Orc", "Goblin Boss", "Troll", "Imp", "Imp" }));
+}
\ No newline at end of file
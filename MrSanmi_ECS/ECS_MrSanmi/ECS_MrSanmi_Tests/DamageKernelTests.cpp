@@ -0,0 +1,176 @@
+#include "Test.h"
+#include "DamageKernel.h"
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: DamageKernelTests.cpp
+ * @brief: Tests of the batch damage kernels against attackDamage().
+ * @details: Only the instruction set the tests are compiled for is exercised (damageKernelIsa()). The project
+ *           builds with /arch:AVX2, which DamageKernelsAreBuiltForTheProjectIsa checks; the SSE4.1 and scalar
+ *           paths need a build with -msse4.1 and one without either. Every length from 0 to 70 is checked so
+ *           each path's scalar tail runs with every remainder.
+ */
+
+namespace {
+
+constexpr size_t MaxLength = 70;
+
+/**
+ * @brief Random 32-bit stats, kept far enough from the limits that attack - defense / 2 cannot overflow.
+ */
+std::vector<int32_t> randomStats(std::mt19937& rng, size_t count) {
+    std::uniform_int_distribution<int32_t> value(std::numeric_limits<int32_t>::min() / 4,
+                                                 std::numeric_limits<int32_t>::max() / 4);
+    std::vector<int32_t> values(count);
+    for (int32_t& v : values) {
+        // Mostly game-sized stats, where the max(1, ...) floor matters, with some extreme ones
+        v = rng() % 4 ? static_cast<int32_t>(rng() % 401) - 100 : value(rng);
+    }
+    return values;
+}
+
+/**
+ * @brief Random 16-bit stats over the whole range, with the limits and their neighbours over-represented.
+ */
+std::vector<int16_t> randomPackedStats(std::mt19937& rng, size_t count) {
+    const int16_t edges[] = { -32768, -32767, -2, -1, 0, 1, 2, 32766, 32767 };
+    std::vector<int16_t> values(count);
+    for (int16_t& v : values) {
+        v = rng() % 3 ? static_cast<int16_t>(rng()) : edges[rng() % std::size(edges)];
+    }
+    return values;
+}
+
+std::vector<uint32_t> randomIndices(std::mt19937& rng, size_t count, size_t range) {
+    std::vector<uint32_t> indices(count);
+    for (uint32_t& index : indices) {
+        index = static_cast<uint32_t>(rng() % range);
+    }
+    return indices;
+}
+
+} // namespace
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+TEST_CASE(DamageKernelsAreBuiltForTheProjectIsa) {
+    // Every configuration of ECS_MrSanmi_Tests sets /arch:AVX2; without it the tests below only cover the scalar path
+    CHECK(std::string(damageKernelIsa()) == "AVX2");
+}
+#endif
+
+TEST_CASE(DamageKernelMatchesAttackDamage) {
+    std::mt19937 rng(21);
+    for (int round = 0; round < 20; ++round) {
+        for (size_t count = 0; count <= MaxLength; ++count) {
+            std::vector<int32_t> attack = randomStats(rng, count);
+            std::vector<int32_t> defense = randomStats(rng, count);
+            std::vector<int32_t> damage(count + 1, -7);
+
+            resolveAttackDamage(attack.data(), defense.data(), damage.data(), count);
+
+            bool same = damage[count] == -7;
+            for (size_t i = 0; i < count; ++i) {
+                same = same && damage[i] == attackDamage(attack[i], defense[i]);
+            }
+            CHECK(same);
+        }
+    }
+}
+
+TEST_CASE(PackedDamageKernelMatchesAttackDamage) {
+    std::mt19937 rng(16);
+    for (int round = 0; round < 20; ++round) {
+        for (size_t count = 0; count <= MaxLength; ++count) {
+            std::vector<int16_t> attack = randomPackedStats(rng, count);
+            std::vector<int16_t> defense = randomPackedStats(rng, count);
+            std::vector<int16_t> damage(count + 1, -7);
+
+            resolveAttackDamage(attack.data(), defense.data(), damage.data(), count);
+
+            bool same = damage[count] == -7;
+            for (size_t i = 0; i < count; ++i) {
+                int32_t expected = std::min<int32_t>(attackDamage(attack[i], defense[i]), 32767);
+                same = same && damage[i] == expected && damage[i] == packedAttackDamage(attack[i], defense[i]);
+            }
+            CHECK(same);
+        }
+    }
+}
+
+TEST_CASE(PackedDamageKernelSaturatesAtTheLimits) {
+    struct Case { int16_t attack; int16_t defense; int16_t damage; };
+    const Case cases[] = {
+        { 32767, -32768, 32767 },     // 32767 + 16384 saturates instead of wrapping
+        { 32767, -2, 32767 },         // 32767 + 1 saturates
+        { 32767, -1, 32767 },         // -1 / 2 truncates to 0
+        { 32767, 32767, 16384 },
+        { -32768, -32768, 1 },        // -32768 + 16384 is below the floor
+        { -32768, 32767, 1 },         // -32768 - 16383 saturates low, then the floor applies
+        { 0, -32768, 16384 },
+        { 0, 32767, 1 },
+        { 1, 0, 1 },
+        { 2, 1, 2 },
+    };
+
+    // 17 copies of each case, so every case lands in vector lanes as well as in the scalar tail
+    std::vector<int16_t> attack;
+    std::vector<int16_t> defense;
+    std::vector<int16_t> expected;
+    for (int copy = 0; copy < 17; ++copy) {
+        for (const Case& c : cases) {
+            attack.push_back(c.attack);
+            defense.push_back(c.defense);
+            expected.push_back(c.damage);
+        }
+    }
+    std::vector<int16_t> damage(attack.size());
+    resolveAttackDamage(attack.data(), defense.data(), damage.data(), attack.size());
+
+    CHECK(damage == expected);
+    for (const Case& c : cases) {
+        CHECK(packedAttackDamage(c.attack, c.defense) == c.damage);
+    }
+}
+
+TEST_CASE(GatherDamageKernelsMatchAttackDamage) {
+    std::mt19937 rng(8);
+    constexpr size_t Combatants = 50;
+    StatsColumns stats;
+    PackedStatsColumns packed;
+    std::vector<int32_t> attackStats = randomStats(rng, Combatants);
+    std::vector<int32_t> defenseStats = randomStats(rng, Combatants);
+    std::vector<int16_t> packedAttack = randomPackedStats(rng, Combatants);
+    std::vector<int16_t> packedDefense = randomPackedStats(rng, Combatants);
+    for (size_t i = 0; i < Combatants; ++i) {
+        stats.push_back(Stats(100, attackStats[i], defenseStats[i], 10, 0));
+        packed.push_back(Stats(100, packedAttack[i], packedDefense[i], 10, 0));
+    }
+
+    // Lengths past the 256-pair gather block as well as short ones
+    for (size_t count : { size_t{ 0 }, size_t{ 1 }, size_t{ 7 }, size_t{ 9 }, size_t{ 17 }, size_t{ 255 },
+                          size_t{ 256 }, size_t{ 257 }, size_t{ 263 }, size_t{ 1000 } }) {
+        std::vector<uint32_t> attackers = randomIndices(rng, count, Combatants);
+        std::vector<uint32_t> targets = randomIndices(rng, count, Combatants);
+        std::vector<int32_t> damage(count);
+        std::vector<int16_t> packedDamage(count);
+
+        resolveAttackDamage(stats, attackers.data(), targets.data(), damage.data(), count);
+        resolveAttackDamage(packed, attackers.data(), targets.data(), packedDamage.data(), count);
+
+        bool same = true;
+        for (size_t i = 0; i < count; ++i) {
+            int32_t attack = stats.attack[attackers[i]];
+            int32_t defense = stats.defense[targets[i]];
+            int16_t packedAttackStat = packed.attack[attackers[i]];
+            int16_t packedDefenseStat = packed.defense[targets[i]];
+            same = same && damage[i] == attackDamage(attack, defense)
+                        && packedDamage[i] == std::min<int32_t>(attackDamage(packedAttackStat, packedDefenseStat), 32767);
+        }
+        CHECK(same);
+    }
+}
\ No newline at end of file
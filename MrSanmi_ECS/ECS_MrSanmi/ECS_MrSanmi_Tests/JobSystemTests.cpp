@@ -0,0 +1,185 @@
+#include "Test.h"
+#include "JobSystem.h"
+#include "Graph.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: JobSystemTests.cpp
+ * @brief: Tests of JobSystem results at 1, 2 and N workers.
+ * @details: Each test runs the same work with every worker count and checks that the results do not depend
+ *           on it: dependencies are respected, idle workers steal, parallelFor covers its range exactly once
+ *           under contention, and the parallel Graph traversal prints what the sequential one prints.
+ */
+
+namespace {
+
+/**
+ * @brief Worker counts every test runs with: one, two, and at least four (more on larger machines).
+ */
+std::vector<size_t> workerCounts() {
+    return { 1, 2, std::max<size_t>(4, std::thread::hardware_concurrency()) };
+}
+
+/**
+ * @brief Captures everything written to std::cout for the lifetime of the object.
+ */
+struct CapturedOutput {
+    std::ostringstream text;
+    std::streambuf* previous;
+
+    CapturedOutput() : previous(std::cout.rdbuf(text.rdbuf())) {}
+    ~CapturedOutput() { std::cout.rdbuf(previous); }
+};
+
+} // namespace
+
+TEST_CASE(JobSystemRunsJobsAfterTheirDependencies) {
+    for (size_t workers : workerCounts()) {
+        JobSystem jobs(workers);
+        std::mt19937 rng(static_cast<uint32_t>(workers));
+
+        constexpr size_t JobCount = 500;
+        std::atomic<uint32_t> clock{ 0 };
+        std::vector<uint32_t> started(JobCount, 0);
+        std::vector<uint32_t> finished(JobCount, 0);
+        std::vector<std::vector<size_t>> dependsOn(JobCount);
+        std::vector<JobHandle> handles;
+
+        // Random task graph: every job depends on up to three earlier ones
+        for (size_t i = 0; i < JobCount; ++i) {
+            std::vector<JobHandle> dependencies;
+            for (size_t d = 0; i > 0 && d < rng() % 4; ++d) {
+                size_t dependency = rng() % i;
+                dependsOn[i].push_back(dependency);
+                dependencies.push_back(handles[dependency]);
+            }
+            handles.push_back(jobs.schedule([&, i] {
+                started[i] = ++clock;
+                finished[i] = ++clock;
+            }, dependencies));
+        }
+        for (const JobHandle& handle : handles) {
+            jobs.wait(handle);
+        }
+
+        for (size_t i = 0; i < JobCount; ++i) {
+            CHECK(finished[i] != 0);
+            for (size_t dependency : dependsOn[i]) {
+                CHECK(started[i] > finished[dependency]);
+            }
+        }
+    }
+}
+
+TEST_CASE(JobSystemIdleWorkersSteal) {
+    for (size_t workers : workerCounts()) {
+        if (workers < 2) continue;
+        JobSystem jobs(workers);
+
+        // The parent queues its children on its own deque and then blocks without helping,
+        // so they can only run if another worker steals them
+        std::atomic<int> childrenRun{ 0 };
+        std::atomic<bool> stolen{ false };
+        JobHandle parent = jobs.schedule([&] {
+            std::thread::id owner = std::this_thread::get_id();
+            for (int i = 0; i < 16; ++i) {
+                jobs.schedule([&, owner] {
+                    if (std::this_thread::get_id() != owner) stolen = true;
+                    ++childrenRun;
+                });
+            }
+
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (childrenRun < 16 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+        });
+        jobs.wait(parent);
+
+        CHECK(stolen);
+        CHECK(childrenRun == 16);
+    }
+}
+
+TEST_CASE(JobSystemParallelForUnderContention) {
+    for (size_t workers : workerCounts()) {
+        JobSystem jobs(workers);
+
+        // Several threads submit ranges at once, and every chunk submits a nested range of its own
+        constexpr size_t Callers = 4;
+        constexpr size_t Range = 20000;
+        std::vector<std::vector<std::atomic<int>>> visits(Callers);
+        std::vector<std::atomic<int64_t>> nestedSums(Callers);
+        for (size_t caller = 0; caller < Callers; ++caller) {
+            visits[caller] = std::vector<std::atomic<int>>(Range);
+            nestedSums[caller] = 0;
+        }
+
+        std::vector<std::thread> callers;
+        for (size_t caller = 0; caller < Callers; ++caller) {
+            callers.emplace_back([&, caller] {
+                jobs.parallelFor(0, Range, 257, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        ++visits[caller][i];
+                    }
+                    jobs.parallelFor(0, 100, 10, [&](size_t nestedBegin, size_t nestedEnd) {
+                        nestedSums[caller] += static_cast<int64_t>(nestedEnd - nestedBegin);
+                    });
+                });
+            });
+        }
+        for (std::thread& caller : callers) {
+            caller.join();
+        }
+
+        size_t chunks = (Range + 256) / 257;
+        for (size_t caller = 0; caller < Callers; ++caller) {
+            bool everyIndexOnce = true;
+            for (const std::atomic<int>& count : visits[caller]) {
+                everyIndexOnce = everyIndexOnce && count == 1;
+            }
+            CHECK(everyIndexOnce);
+            CHECK(nestedSums[caller] == static_cast<int64_t>(chunks * 100));
+        }
+    }
+}
+
+TEST_CASE(GraphParallelBFSMatchesSequential) {
+    // Random graph with shared children and cycles, so the claiming order matters
+    constexpr int NodeCount = 1500;
+    std::mt19937 rng(42);
+    Graph<int> graph(0);
+    for (int node = 1; node < NodeCount; ++node) {
+        graph.insert(static_cast<int>(rng() % node), node);
+    }
+    for (int edge = 0; edge < NodeCount / 2; ++edge) {
+        graph.insert(static_cast<int>(rng() % NodeCount), static_cast<int>(rng() % NodeCount));
+    }
+
+    std::string expected;
+    {
+        CapturedOutput output;
+        graph.traverseBFS();
+        expected = output.text.str();
+    }
+    CHECK(!expected.empty());
+
+    for (size_t workers : workerCounts()) {
+        JobSystem jobs(workers);
+        for (int run = 0; run < 2; ++run) {
+            CapturedOutput output;
+            graph.traverseBFS(jobs);
+            std::string actual = output.text.str();
+            CHECK(actual == expected);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#include "Test.h"
+#include "World.h"
+#include <algorithm>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: ObserverTests.cpp
+ * @brief: Tests of the batched component events collected by Observer.
+ */
+
+TEST_CASE(ObserverKeepsEventsOfRecycledSlots) {
+    World world;
+    Observer& health = world.observe<CombatState>(ComponentEvent::Added | ComponentEvent::Removed);
+
+    EntityId goblin = world.createEntity();
+    world.addComponent<CombatState>(goblin, Stats(10));
+    health.drain([](EntityId) {});
+
+    // The goblin is destroyed and its slot reused before anyone drains the observer
+    world.destroyEntity(goblin);
+    EntityId orc = world.createEntity();
+    world.addComponent<CombatState>(orc, Stats(25));
+    CHECK(orc.index == goblin.index);
+
+    std::vector<EntityId> seen;
+    health.drain([&](EntityId entity) { seen.push_back(entity); });
+    CHECK(seen.size() == 2);
+    CHECK(std::find(seen.begin(), seen.end(), goblin) != seen.end());
+    CHECK(std::find(seen.begin(), seen.end(), orc) != seen.end());
+    CHECK(!world.isAlive(goblin));
+}
+
+TEST_CASE(ObserverListsEachHandleOnce) {
+    World world;
+    Observer& health = world.observe<CombatState>(ComponentEvent::Added | ComponentEvent::Changed);
+
+    EntityId hero = world.createEntity();
+    world.addComponent<CombatState>(hero, Stats(100));
+    world.getComponent<CombatState>(hero)->health -= 10;
+    world.getComponent<CombatState>(hero)->health -= 10;
+    CHECK(health.size() == 1);
+
+    health.drain([](EntityId) {});
+    CHECK(health.empty());
+    world.getComponent<CombatState>(hero)->mana -= 5;
+    CHECK(health.size() == 1);
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "Test.h"
+#include "Query.h"
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: QueryTests.cpp
+ * @brief: Tests of the archetype cache kept by Query.
+ */
+
+namespace {
+
+EntityId addCombatant(World& world, int32_t health) {
+    EntityId entity = world.createEntity();
+    world.addComponent<CombatState>(entity, Stats(health, 10, 5, 10, 0));
+    world.addComponent<Alive>(entity);
+    return entity;
+}
+
+template<typename... Ts>
+std::vector<EntityId> matches(Query<Ts...>& query) {
+    std::vector<EntityId> entities;
+    query.each([&](EntityId entity, const auto&...) { entities.push_back(entity); });
+    return entities;
+}
+
+} // namespace
+
+TEST_CASE(QueryPicksUpArchetypesCreatedAfterItsCacheIsWarm) {
+    World world;
+    Query<const CombatState> living = world.query<const CombatState>();
+    living.with<Alive>();
+
+    EntityId first = addCombatant(world, 50);
+    CHECK(matches(living) == std::vector<EntityId>{ first });
+
+    // Each tag creates an archetype the cache has not seen yet
+    EntityId player = addCombatant(world, 60);
+    world.addComponent<PlayerTeam>(player);
+    EntityId enemy = addCombatant(world, 70);
+    world.addComponent<EnemyTeam>(enemy);
+    CHECK(matches(living) == (std::vector<EntityId>{ first, player, enemy }));
+
+    // Leaving a cached archetype drops the entity without rebuilding anything
+    world.removeComponent<Alive>(player);
+    world.addComponent<Dead>(player);
+    CHECK(matches(living) == (std::vector<EntityId>{ first, enemy }));
+}
+
+TEST_CASE(QueryFiltersDropTheCache) {
+    World world;
+    EntityId player = addCombatant(world, 50);
+    world.addComponent<PlayerTeam>(player);
+    EntityId enemy = addCombatant(world, 60);
+    world.addComponent<EnemyTeam>(enemy);
+    EntityId defeated = addCombatant(world, 0);
+    world.addComponent<EnemyTeam>(defeated);
+    world.addComponent<Dead>(defeated);
+
+    // This call fills the cache with the archetypes of all three
+    Query<const CombatState> query = world.query<const CombatState>();
+    query.with<Alive>();
+    CHECK(matches(query).size() == 3);
+
+    // A stale cache would still report the other teams
+    query.with<EnemyTeam>();
+    CHECK(matches(query) == (std::vector<EntityId>{ enemy, defeated }));
+
+    query.without<Dead>();
+    CHECK(matches(query) == std::vector<EntityId>{ enemy });
+}
+
+TEST_CASE(QueryRebuildsItsCacheAfterWorldReset) {
+    World world;
+    Query<const CombatState> enemies = world.query<const CombatState>();
+    enemies.with<EnemyTeam>();
+
+    EntityId enemy = addCombatant(world, 50);
+    world.addComponent<EnemyTeam>(enemy);
+    addCombatant(world, 60);
+    CHECK(matches(enemies) == std::vector<EntityId>{ enemy });
+
+    // After a reset the cached archetypes are gone, and archetype indices are handed out again
+    // in a different order: the player layout now comes first
+    world.reset();
+    CHECK(matches(enemies).empty());
+
+    EntityId player = addCombatant(world, 70);
+    world.addComponent<PlayerTeam>(player);
+    EntityId newEnemy = addCombatant(world, 80);
+    world.addComponent<EnemyTeam>(newEnemy);
+    CHECK(matches(enemies) == std::vector<EntityId>{ newEnemy });
+    CHECK(!enemies.empty());
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "Test.h"
+#include "Skill.h"
+#include <iostream>
+#include <sstream>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: SkillTests.cpp
+ * @brief: Tests of the SkillFactory effect programs.
+ */
+
+namespace {
+
+EntityId addCombatant(World& world, const char* name, const Stats& stats) {
+    EntityId entity = world.createEntity();
+    world.addComponent<DisplayInfo>(entity, name);
+    world.addComponent<CombatState>(entity, stats);
+    world.addComponent<CombatBaseStats>(entity, stats);
+    world.addComponent<Alive>(entity);
+    return entity;
+}
+
+} // namespace
+
+TEST_CASE(SkillsDealAttackDamage) {
+    std::ostringstream sink;
+    std::streambuf* previous = std::cout.rdbuf(sink.rdbuf());
+
+    World world;
+    CommandBuffer commands(world);
+    Entity mage(world, addCombatant(world, "Mage", Stats(80, 25, 5, 8, 1000)));
+
+    // Defense values around 0, odd and negative exercise the truncating division of the formula
+    for (int32_t defense : { -7, -1, 0, 1, 9, 40, 49, 50, 51, 200 }) {
+        Entity target(world, addCombatant(world, "Dummy", Stats(1000, 10, defense, 5, 0)));
+
+        SkillFactory::createAttackSkill().execute(mage, target, commands);
+        CHECK(1000 - target.readComponent<CombatState>()->health == attackDamage(25, defense));
+
+        int32_t health = target.readComponent<CombatState>()->health;
+        SkillFactory::createFireballSkill().execute(mage, target, commands);
+        CHECK(health - target.readComponent<CombatState>()->health == attackDamage(50, defense));
+    }
+
+    std::cout.rdbuf(previous);
+}
+
+TEST_CASE(SkillDefeatIsAppliedWhenCommandsFlush) {
+    std::ostringstream sink;
+    std::streambuf* previous = std::cout.rdbuf(sink.rdbuf());
+
+    World world;
+    CommandBuffer commands(world);
+    Entity warrior(world, addCombatant(world, "Warrior", Stats(120, 30, 10, 10, 20)));
+    Entity goblin(world, addCombatant(world, "Goblin", Stats(5, 10, 2, 10, 0)));
+
+    SkillFactory::createAttackSkill().execute(warrior, goblin, commands);
+
+    // The effect only records the tag swap; the goblin changes archetype at the flush
+    CHECK(goblin.readComponent<CombatState>()->health <= 0);
+    CHECK(goblin.hasComponent<Alive>());
+    CHECK(!goblin.hasComponent<Dead>());
+    CHECK(!commands.empty());
+    CHECK(sink.str().find("Goblin has been defeated!") != std::string::npos);
+
+    commands.flush();
+    CHECK(!goblin.hasComponent<Alive>());
+    CHECK(goblin.hasComponent<Dead>());
+
+    std::cout.rdbuf(previous);
+}
+
+TEST_CASE(EffectStopsAtAComponentItsSubjectLacks) {
+    World world;
+    CommandBuffer commands(world);
+    EntityId priest = addCombatant(world, "Priest", Stats(60, 5, 5, 10, 50));
+    EntityId statue = world.createEntity();
+    world.addComponent<DisplayInfo>(statue, "Statue");
+
+    // The statue's components are only looked up by the Heal, after the first SpendMana has run
+    EffectBuilder b;
+    b.push(10).op(EffectOp::SpendMana, EffectSubject::User)
+     .push(20).op(EffectOp::Heal, EffectSubject::Target)
+     .push(10).op(EffectOp::SpendMana, EffectSubject::User);
+    executeEffect(b.build(), world, commands, priest, statue);
+
+    CHECK(world.readComponent<CombatState>(priest)->mana == 40);
+    CHECK(!world.hasComponent<CombatState>(statue));
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdio>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: Test.h
+ * @brief: Minimal test harness for the ECS_MrSanmi_Tests executable.
+ * @details: Each test is a function registered with TEST_CASE(name) in the .cpp file of the module it
+ *           covers. CHECK records a failure and lets the test continue, so one run reports every broken
+ *           expectation. The executable returns non-zero if any check failed.
+ */
+
+/**
+ * @brief Defines and registers a test function.
+ */
+#define TEST_CASE(name) \
+    static void name(); \
+    static test::Registrar name##Registrar(#name, name); \
+    static void name()
+
+/**
+ * @brief Records a failure, with its location, if the condition is false.
+ */
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) test::fail(__FILE__, __LINE__, #condition); \
+    } while (0)
+
+namespace test {
+
+/**
+ * @brief A registered test.
+ */
+struct Case {
+    const char* name;   ///< Name used for filtering and in the output
+    void (*run)();      ///< Runs the test's checks
+};
+
+/**
+ * @brief Retrieves every registered test, in registration order.
+ */
+inline std::vector<Case>& registry() {
+    static std::vector<Case> cases;
+    return cases;
+}
+
+/**
+ * @brief Registers a test during static initialization (used by TEST_CASE).
+ */
+struct Registrar {
+    Registrar(const char* name, void (*run)()) {
+        registry().push_back(Case{ name, run });
+    }
+};
+
+/**
+ * @brief Counts the failed checks of the whole run.
+ */
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+/**
+ * @brief Reports a failed check (used by CHECK).
+ */
+inline void fail(const char* file, int line, const char* expression) {
+    std::printf("    %s:%d: CHECK(%s) failed\n", file, line, expression);
+    ++failures();
+}
+
+} // namespace test
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "Test.h"
+#include <cstring>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: TestMain.cpp
+ * @brief: Entry point of the test executable.
+ * @details: Runs every registered test, or only those whose name contains the first argument.
+ */
+
+/**
+ * @brief Test runner entry point.
+ * @return 0 if every check passed, 1 otherwise.
+ */
+int main(int argc, char** argv) {
+    const char* filter = argc > 1 ? argv[1] : "";
+    int failedTests = 0;
+    int ranTests = 0;
+
+    for (const test::Case& testCase : test::registry()) {
+        if (std::strstr(testCase.name, filter) == nullptr) continue;
+
+        int before = test::failures();
+        testCase.run();
+        bool passed = test::failures() == before;
+        std::printf("[%s] %s\n", passed ? "  OK  " : " FAIL ", testCase.name);
+
+        ++ranTests;
+        if (!passed) ++failedTests;
+    }
+
+    std::printf("\n%d of %d tests passed\n", ranTests - failedTests, ranTests);
+    return failedTests == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "Test.h"
+#include "TurnSystem.h"
+#include <iostream>
+#include <sstream>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: TurnSystemTests.cpp
+ * @brief: Tests of TurnSystem's use of the battle resources stored in the World.
+ */
+
+TEST_CASE(TurnSystemFollowsReplacedResources) {
+    std::ostringstream sink;
+    std::streambuf* previous = std::cout.rdbuf(sink.rdbuf());
+
+    World world;
+    TurnSystem turns(world);
+
+    EntityId hero = world.createEntity();
+    world.addComponent<DisplayInfo>(hero, "Hero");
+    world.addComponent<CombatState>(hero, Stats(100, 10, 5, 10, 20));
+    world.addComponent<CombatBaseStats>(hero, Stats(100, 10, 5, 10, 20));
+    world.addComponent<Alive>(hero);
+    world.addComponent<PlayerTeam>(hero);
+
+    // Removing and re-inserting the resources must not leave the system pointing at the old ones
+    world.removeResource<BattleStatus>();
+    world.removeResource<TurnCounter>();
+    world.insertResource<TurnCounter>();
+    CHECK(turns.getCurrentState() == BattleState::TURN_START);
+
+    turns.calculateTurnOrder();
+    CHECK(world.getResource<TurnCounter>()->round == 1);
+    CHECK(world.getResource<BattleStatus>() != nullptr);
+
+    turns.setState(BattleState::PLAYER_CHOICE);
+    CHECK(world.getResource<BattleStatus>()->state == BattleState::PLAYER_CHOICE);
+
+    std::cout.rdbuf(previous);
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "Test.h"
+#include "Prefab.h"
+#include "View.h"
+#include <thread>
+#include <vector>
+
+/**
+ * @Author: Miguel Angel Garcia Elizalde
+ * @Date: October, 2026
+ * @file: ViewTests.cpp
+ * @brief: Tests of the parallel View iteration.
+ */
+
+namespace {
+
+/**
+ * @brief Spawns about 100k combatants with varied health, so a float sum rounds differently in every order.
+ */
+void spawnWave(World& world) {
+    Prefab prefab;
+    prefab.add<CombatState>(Stats(100, 10, 5, 10, 0)).add<CombatBaseStats>(Stats(100, 10, 5, 10, 0)).add<Alive>();
+    std::vector<EntityId> wave = world.spawnBatch(prefab, 100000);
+    for (size_t i = 0; i < wave.size(); ++i) {
+        world.getComponent<CombatState>(wave[i])->health = static_cast<int32_t>(i * 7919 % 100003);
+    }
+}
+
+float healthSum(World& world) {
+    return world.view<const CombatState>().with<Alive>().parReduce(0.0f,
+        [](float& sum, EntityId, const CombatState& state) { sum += static_cast<float>(state.health) * 0.37f; },
+        [](float a, float b) { return a + b; });
+}
+
+} // namespace
+
+TEST_CASE(DeterministicReduceIsIdenticalForAnyWorkerCount) {
+    World world;
+    spawnWave(world);
+
+    // No JobSystem: work items run in order on this thread
+    float expected = healthSum(world);
+
+    for (size_t workers : { size_t{ 1 }, size_t{ 2 }, std::max<size_t>(4, std::thread::hardware_concurrency()) }) {
+        world.insertResource<JobSystem>(workers);
+        for (int run = 0; run < 3; ++run) {
+            CHECK(healthSum(world) == expected);
+        }
+        world.removeResource<JobSystem>();
+    }
+}
\ No newline at end of file
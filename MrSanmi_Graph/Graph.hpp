@@ -1,5 +1,8 @@
 #pragma once
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 #include "Queue.hpp"
 #include "Stack.hpp"
 #include "DoubleLinkedList.hpp"
@@ -50,6 +53,8 @@ public:
 
     // Accessors
     void traverseBFS();
+    template <class Jobs>
+    void traverseBFS(Jobs& t_jobs);
     void traverseDFS();
 
     // Mutators
@@ -328,6 +333,80 @@ void Graph<T>::traverseBFS() {
     reset(visitedNodes);
 }
 
+/**
+ * @brief Performs Breadth-First Search traversal on a job system and prints the graph structure
+ * @tparam T Type of data stored in the graph
+ * @tparam Jobs Job system providing parallelFor(begin, end, grain, fn), e.g. JobSystem from MrSanmi_ECS
+ * @param t_jobs Job system the work of each level is submitted to
+ *
+ * Output is identical to traverseBFS(). The graph is walked one level at a time: the workers format the
+ * line of every node in the level and collect its children not visited yet, then the results are merged
+ * in queue order, claiming each child for the first parent that reaches it as the sequential version does.
+ * Depth-first order depends on every previous step, so traverseDFS() has no parallel counterpart.
+ * The graph must not be modified while it is traversed.
+ */
+template <class T>
+template <class Jobs>
+void Graph<T>::traverseBFS(Jobs& t_jobs) {
+    if (!m_pRoot) {
+        return;
+    }
+
+    // Levels are indexed by the workers, so they are kept in vectors rather than in a Queue
+    std::vector<NodeGraph*> visitedNodes;
+    std::vector<NodeGraph*> currentLevel{ m_pRoot };
+    m_pRoot->has_been_visited = true;
+    visitedNodes.push_back(m_pRoot);
+
+    while (!currentLevel.empty()) {
+        std::vector<std::string> lines(currentLevel.size());
+        std::vector<std::vector<NodeGraph*>> newChildren(currentLevel.size());
+
+        // Workers only read the graph and the flags set while merging earlier levels
+        t_jobs.parallelFor(0, currentLevel.size(), 64, [&](size_t t_begin, size_t t_end) {
+            for (size_t n = t_begin; n < t_end; n++) {
+                NodeGraph* currentNode = currentLevel[n];
+                std::ostringstream line;
+                line << currentNode->m_data << "(";
+
+                for (size_t i = 0; i < currentNode->m_children.size(); i++) {
+                    NodeGraph* child = currentNode->m_children[i];
+                    if (!child->has_been_visited) {
+                        newChildren[n].push_back(child);
+                    }
+
+                    line << child->m_data;
+                    if (i < currentNode->m_children.size() - 1) {
+                        line << ", ";
+                    }
+                }
+
+                line << ")";
+                lines[n] = line.str();
+            }
+        });
+
+        // Merge in queue order: a child shared by several parents of this level goes to the first one
+        std::vector<NodeGraph*> nextLevel;
+        for (size_t n = 0; n < currentLevel.size(); n++) {
+            cout << lines[n] << endl;
+
+            for (NodeGraph* child : newChildren[n]) {
+                if (!child->has_been_visited) {
+                    child->has_been_visited = true;
+                    visitedNodes.push_back(child);
+                    nextLevel.push_back(child);
+                }
+            }
+        }
+        currentLevel.swap(nextLevel);
+    }
+
+    for (NodeGraph* node : visitedNodes) {
+        node->has_been_visited = false;
+    }
+}
+
 /**
  * @brief Performs Depth-First Search traversal and prints the graph structure
  * @tparam T Type of data stored in the graph